@@ -3,7 +3,7 @@
 
 #include <string>
 #include <ostream>
-#include "general/Enum.hpp"
+#include "general/EnumStrings.hpp"
 
 class Player {
 public:
@@ -38,8 +38,7 @@ public:
         os << "ID: " << player.id
         << ", Name: " << player.name
         << ", Age: " << player.age
-        << ", Gender: " << (player.gender == Gender::Male ? "Male" :
-                            player.gender == Gender::Female ? "Female" : "Other")
+        << ", Gender: " << toString(player.gender)
         << ", Email: " << player.email
         << ", Phone: " << player.phoneNum
         << ", Points: " << player.points
@@ -52,15 +51,11 @@ public:
 
 };
 
-inline std::string genderToString(Gender gender) {
-    switch (gender) {
-        case Gender::Male:   
-            return "Male";
-        case Gender::Female: 
-            return "Female";
-        default:             
-            return "Other";
+// Key extractor for containers indexed by player id
+struct PlayerIdKey {
+    const std::string& operator()(const Player& player) const {
+        return player.id;
     }
-}
+};
 
 #endif
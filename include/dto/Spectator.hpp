@@ -2,7 +2,7 @@
 #define SPECTATOR_HPP
 
 #include <string>
-#include "general/Enum.hpp"
+#include "general/EnumStrings.hpp"
 
 class Spectator
 {
@@ -20,23 +20,4 @@ public:
         : id(id), name(name), gender(gender), email(email), phoneNum(phoneNum), type(type), affiliation(affiliation) {}
 };
 
-inline std::string toString(SpectatorType type)
-{
-    switch (type)
-    {
-    case SpectatorType::Normal:
-        return "Normal";
-    case SpectatorType::VIP:
-        return "VIP";
-    case SpectatorType::Streamer:
-        return "Streamer";
-    case SpectatorType::Influencer:
-        return "Influencer";
-    case SpectatorType::Player:
-        return "Player";
-    default:
-        return "Unknown";
-    }
-}
-
 #endif
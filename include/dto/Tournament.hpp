@@ -2,7 +2,7 @@
 #define TOURNAMENT_HPP
 
 #include <string>
-#include "general/Enum.hpp"
+#include "general/EnumStrings.hpp"
 
 class Tournament {
 public:
@@ -29,26 +29,4 @@ public:
           currentParticipants(currentParticipants), prizePool(prizePool) {}
 };
 
-inline std::string toString(TournamentCategory category) {
-    switch (category) {
-        case TournamentCategory::Local: return "Local";
-        case TournamentCategory::Regional: return "Regional";
-        case TournamentCategory::National: return "National";
-        case TournamentCategory::International: return "International";
-        default: return "Regional";  // Default to Regional if unknown
-    }
-}
-
-inline std::string toString(TournamentStage stage) {
-    switch (stage) {
-        case TournamentStage::Registration: return "Registration";
-        case TournamentStage::Qualifiers: return "Qualifiers";
-        case TournamentStage::Quarterfinals: return "Quarterfinals";
-        case TournamentStage::Semifinals: return "Semifinals";
-        case TournamentStage::Finals: return "Finals";
-        case TournamentStage::Completed: return "Completed";
-        default: return "Registration";
-    }
-}
-
 #endif
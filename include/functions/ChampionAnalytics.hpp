@@ -0,0 +1,61 @@
+#ifndef CHAMPIONANALYTICS_HPP
+#define CHAMPIONANALYTICS_HPP
+
+#include <string>
+#include "general/EnumStrings.hpp"
+#include "helper/ResultJoin.hpp"
+
+// Champion x champion matchup matrix over the joined results.
+//
+// wins[winner * SLOTS + loser] counts the games a champion won against
+// another (NoChampion is a valid row/column, for results missing a pick).
+// A champion's wins, losses and picks are row and column sums, so only the
+// matrix is maintained: one increment per result. Rows are padded to 16
+// counters and the matrix is cache-line aligned, so each row is one 64-byte
+// line and the sums and merges below are plain loops the compiler
+// vectorizes.
+class ChampionAnalytics {
+public:
+    static const int CHAMPIONS = static_cast<int>(EnumTable<Champion>::COUNT) - 1; // Excluding NoChampion
+    static const int SLOTS = 16;
+
+    ChampionAnalytics();
+
+    void clear();
+
+    // Count one joined result; skipped if its match is unknown or the
+    // winner is neither player
+    void record(const JoinedRow& row);
+
+    // Recount the first count rows of join from scratch
+    void rebuild(const ResultJoin& join, int count);
+
+    int getResultCount() const { return results; }
+
+    // The SLOTS * SLOTS counters (winner-major), to save and restore the
+    // matrix with a statistics checkpoint
+    const int* getCounts() const { return wins; }
+    void restore(const int* counts);
+
+    // Games winner won against loser
+    int getWins(Champion winner, Champion loser) const;
+
+    // Totals for one champion (a mirror match counts one win and one loss)
+    int getWins(Champion champion) const;
+    int getLosses(Champion champion) const;
+    int getPicks(Champion champion) const { return getWins(champion) + getLosses(champion); }
+    float getWinRate(Champion champion) const;
+
+    // Parse a champion name ignoring case ("leesin" -> LeeSin); false if
+    // it names no champion
+    static bool parseChampion(const std::string& text, Champion& champion);
+
+private:
+    alignas(64) int wins[SLOTS * SLOTS];
+    int results;
+
+    // winner * SLOTS + loser for the row, or -1 if it cannot be counted
+    static int encode(const JoinedRow& row);
+};
+
+#endif
@@ -6,141 +6,20 @@
 #include "../dto/Performance.hpp"
 #include "../dto/Player.hpp"
 #include "../structures/Stack.hpp"
+#include "../structures/ChunkedLog.hpp"
 #include "../helper/JsonLoader.hpp"
+#include "../helper/ResultStore.hpp"
+#include "../helper/ResultJoin.hpp"
+#include "PlayerStatsTable.hpp"
+#include "ChampionAnalytics.hpp"
 #include "nlohmann/json.hpp"
+#include <cstdint>
 #include <iostream>
 #include <string>
 #include <iomanip>
 #include <fstream>
 #include <filesystem>
 
-// Forward declarations for custom data structures
-template<typename T>
-struct HistoryNode {
-    T data;
-    HistoryNode* next;
-    
-    HistoryNode(const T& item) : data(item), next(nullptr) {}
-};
-
-template<typename T>
-class LinkedHistory {
-private:
-    HistoryNode<T>* head;
-    HistoryNode<T>* tail;
-    int size;
-    
-public:
-    LinkedHistory() : head(nullptr), tail(nullptr), size(0) {}
-    
-    ~LinkedHistory() {
-        clear();
-    }
-    
-    void addRecord(const T& record) {
-        HistoryNode<T>* newNode = new HistoryNode<T>(record);
-        if (!head) {
-            head = tail = newNode;
-        } else {
-            tail->next = newNode;
-            tail = newNode;
-        }
-        ++size;
-    }
-    
-    void clear() {
-        while (head) {
-            HistoryNode<T>* temp = head;
-            head = head->next;
-            delete temp;
-        }
-        head = tail = nullptr;
-        size = 0;
-    }
-    
-    int getSize() const { return size; }
-    bool isEmpty() const { return head == nullptr; }
-    
-    // Iterator-like access
-    HistoryNode<T>* getHead() const { return head; }
-};
-
-// Player statistics structure for performance tracking
-struct PlayerStats {
-    std::string playerId;
-    std::string playerName;
-    int totalMatches;
-    int wins;
-    int losses;
-    float winRate;
-    Champion mostUsedChampion;
-    int championUsageCount[12]; // Track usage for each champion (0-11)
-    std::string lastMatchDate;
-    int currentWinStreak;
-    int longestWinStreak;
-    float averageGameDuration; // in minutes
-    
-    PlayerStats() : playerId(""), playerName(""), totalMatches(0), wins(0), losses(0), 
-                   winRate(0.0f), mostUsedChampion(Champion::NoChampion), 
-                   lastMatchDate(""), currentWinStreak(0), longestWinStreak(0),
-                   averageGameDuration(0.0f) {
-        for (int i = 0; i < 12; ++i) {
-            championUsageCount[i] = 0;
-        }
-    }
-    
-    PlayerStats(const std::string& id, const std::string& name) : playerId(id), playerName(name),
-                totalMatches(0), wins(0), losses(0), winRate(0.0f),
-                mostUsedChampion(Champion::NoChampion), lastMatchDate(""),
-                currentWinStreak(0), longestWinStreak(0), averageGameDuration(0.0f) {
-        for (int i = 0; i < 12; ++i) {
-            championUsageCount[i] = 0;
-        }
-    }
-    
-    void updateStats(bool isWin, Champion champion, const std::string& matchDate, float gameDuration) {
-        totalMatches++;
-        if (isWin) {
-            wins++;
-            currentWinStreak++;
-            if (currentWinStreak > longestWinStreak) {
-                longestWinStreak = currentWinStreak;
-            }
-        } else {
-            losses++;
-            currentWinStreak = 0;
-        }
-        
-        winRate = (totalMatches > 0) ? (static_cast<float>(wins) / totalMatches) * 100.0f : 0.0f;
-        
-        // Update champion usage
-        if (champion != Champion::NoChampion) {
-            int championIndex = static_cast<int>(champion);
-            if (championIndex >= 0 && championIndex < 52) {
-                championUsageCount[championIndex]++;
-                
-                // Find most used champion
-                int maxUsage = 0;
-                for (int i = 0; i < 52; ++i) {
-                    if (championUsageCount[i] > maxUsage) {
-                        maxUsage = championUsageCount[i];
-                        mostUsedChampion = static_cast<Champion>(i);
-                    }
-                }
-            }
-        }
-        
-        lastMatchDate = matchDate;
-        
-        // Update average game duration
-        if (totalMatches > 1) {
-            averageGameDuration = ((averageGameDuration * (totalMatches - 1)) + gameDuration) / totalMatches;
-        } else {
-            averageGameDuration = gameDuration;
-        }
-    }
-};
-
 // Match summary for recent results display
 struct MatchSummary {
     int matchId;
@@ -162,42 +41,51 @@ struct MatchSummary {
                   winnerName(winner), stage(st), duration(dur) {}
 };
 
-// Helper structure to store match player information from JSON
-struct MatchPlayerInfo {
-    std::string matchId;
-    std::string player1Id;
-    std::string player2Id;
-    std::string winnerId;
-    
-    MatchPlayerInfo() : matchId(""), player1Id(""), player2Id(""), winnerId("") {}
-    MatchPlayerInfo(const std::string& mid, const std::string& p1, const std::string& p2, const std::string& winner) 
-        : matchId(mid), player1Id(p1), player2Id(p2), winnerId(winner) {}
-};
-
 class GameResultLogger {
 private:
     // ===============================================
     // TASK 4 CORE DATA STRUCTURES (JsonLoader → DoublyLinkedList → Stack)
     // ===============================================
     
-    // JsonLoader handles DoublyLinkedList internally - we don't store it directly
+    // results.json stays resident in the store; queries only re-read the file
+    // (or its tail) when it changed, and new results arrive via ResultEvents
     int loadedResultsCount;
+    mutable ResultStore resultStore{"data/results.json"};
+    mutable ResultJoin resultJoin{resultStore};       // Result -> Match -> Player
     
     // Stack-based operations for Task 4 functionality
     Stack<Result> searchResultsStack;                 // For storing search results
     Stack<PlayerStats> playerAnalysisStack;           // For player analysis operations
     Stack<std::string> operationHistoryStack;        // Track operations performed
+    ChunkedLog<std::string> operationLog;             // Append-only audit trail (newest ~1000 kept)
     Stack<MatchSummary> processingStack;              // For general processing operations
     
-    // Player performance tracking (simplified for Task 4)
-    static const int MAX_PLAYERS = 100;
+    // Player performance tracking, one table slot per player seen in results
     static const int MAX_RECENT_MATCHES = 50;
-    PlayerStats playerStatistics[MAX_PLAYERS];
-    int playerCount;
+    PlayerStatsTable statsTable;
+    ChampionAnalytics championAnalytics;              // Champion matchups over the same results
+    
+    // Statistics are maintained incrementally: statsIngested joined rows have
+    // been applied (as of join generation statsGeneration), new results are
+    // applied as they are published, and a checkpoint lets a restart skip
+    // the rows it covers while the files it was taken from are unchanged
+    static const int CHECKPOINT_INTERVAL = 1000;      // Results between checkpoint saves
+    std::string checkpointFile;
+    int statsIngested;
+    long long statsGeneration;
+    int checkpointedCount;                            // statsIngested when last checkpointed
+    int resultSubscription;
     
     // Helper functions
     int findPlayerIndex(const std::string& playerId) const;
-    std::string stageToString(TournamentStage stage) const;
+    int addPlayerStats(const std::string& playerId, const Player* player);
+    void displayJoinedRow(const JoinedRow& row) const;
+    void resetPlayerStatistics();
+    void updatePlayerStatistics();                    // Sync with the files, then apply new results
+    void applyJoinedResults();                        // Apply joined results not yet counted
+    void ingestResult(const JoinedRow& row);
+    bool restoreStatsCheckpoint();
+    void saveStatsCheckpoint();                       // Right after resultJoin.sync()
     
 public:
     GameResultLogger();
@@ -210,6 +98,8 @@ public:
     // JSON Data Loading using JsonLoader (which handles DoublyLinkedList internally)
     void loadResultsFromJSON();
     void loadResultsFromJSON(const std::string& jsonPath);
+    void refreshResults();                            // Re-read results.json in full
+    void displayResultStoreStats() const;             // Hits vs reloads of the resident store
     
     // Data operations using JsonLoader results
     void displayLoadedResults() const;                // Display results from JsonLoader
@@ -235,11 +125,12 @@ public:
     void clearOperationHistory();                      // Clear operation history
     
     // Statistical Analysis from JsonLoader data (DoublyLinkedList handled internally)
-    void calculatePlayerStatistics();
+    void calculatePlayerStatistics();                 // Recount every result from scratch
     void displayPlayerPerformance(const std::string& playerId) const;
     void searchMatchesByPlayer(const std::string& playerId) const;
     void searchMatchesByMatchId(const std::string& matchId) const;
     void displayPlayerFavoriteChampions() const;
+    void displayChampionStatistics(const std::string& championName) const;
     void displayPlayerMatchCount() const;
     void displayPlayerWinRates() const;
     void displayComprehensivePlayerStats() const;
@@ -54,7 +54,6 @@ public:
     static void displayTournamentBracket(const DynamicArray<Match>& matches);
     
     // Utility functions
-    static std::string stageToString(TournamentStage stage);
     static std::string formatDateTime();
     static std::string getNextMatchId();
 };
@@ -3,6 +3,7 @@
 
 #include "dto/Player.hpp"
 #include "structures/PriorityQueue.hpp"
+#include "structures/HashMap.hpp"
 #include "functions/PlayerManager.hpp"
 #include "functions/TournamentManager.hpp"
 #include "helper/JsonWriter.hpp"
@@ -10,8 +11,9 @@
 
 class PlayerRegistration {
 private:
-    PriorityQueue<Player> checkInQueue;
+    CheckInQueue checkInQueue;
     DoublyLinkedList<Player> registeredPlayers;
+    HashMap<std::string, DoublyLinkedList<Player>::Iterator> registeredById;  // Index into registeredPlayers
     PlayerManager playerManager;
     TournamentManager tournamentManager;
     int nextPlayerId;
@@ -31,7 +33,7 @@ public:
     void displayRegisteredPlayers();
     void displayCheckInQueue();
     int getTotalCheckedInPlayers() const;
-    PriorityQueue<Player> getCheckInQueue() const;
+    CheckInQueue getCheckInQueue() const;
     void displayAllPlayersInDatabase();
     void saveCurrentRegisteredPlayers();
     void saveCurrentCheckInQueue();
@@ -44,6 +46,8 @@ public:
 private:
     void handleStatusInheritance(bool wasEarlyBird, bool wasRegular);
     void updatePlayerPriorityInQueue(const std::string& playerId, int newPriority);
+    void rebuildRegisteredIndex();
+    void eraseRegistered(DoublyLinkedList<Player>::Iterator position);
 };
 
 #endif
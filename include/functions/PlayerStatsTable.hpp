@@ -0,0 +1,112 @@
+#ifndef PLAYERSTATSTABLE_HPP
+#define PLAYERSTATSTABLE_HPP
+
+#include <string>
+#include "general/Enum.hpp"
+#include "structures/DynamicArray.hpp"
+#include "structures/HashMap.hpp"
+
+// Player statistics structure for performance tracking. A snapshot of one
+// row of PlayerStatsTable (analysis stack, checkpoints, single-player views).
+struct PlayerStats {
+    static const int CHAMPION_SLOTS = 12;   // One per Champion value (0-11)
+
+    std::string playerId;
+    std::string playerName;
+    int totalMatches;
+    int wins;
+    int losses;
+    float winRate;
+    Champion mostUsedChampion;
+    int championUsageCount[CHAMPION_SLOTS]; // Track usage for each champion (0-11)
+    std::string lastMatchDate;
+    int currentWinStreak;
+    int longestWinStreak;
+    float averageGameDuration; // in minutes
+    
+    PlayerStats() : PlayerStats("", "") {}
+    
+    PlayerStats(const std::string& id, const std::string& name) : playerId(id), playerName(name),
+                totalMatches(0), wins(0), losses(0), winRate(0.0f),
+                mostUsedChampion(Champion::NoChampion), lastMatchDate(""),
+                currentWinStreak(0), longestWinStreak(0), averageGameDuration(0.0f) {
+        for (int i = 0; i < CHAMPION_SLOTS; ++i) {
+            championUsageCount[i] = 0;
+        }
+    }
+};
+
+// Growable statistics table for any number of players.
+//
+// Each player owns one dense slot, found by id through a hash index. The
+// counters that whole-table passes read (matches, wins, losses, streaks) are
+// kept column by column (structure of arrays), so a leaderboard or win-rate
+// pass streams through a few contiguous int arrays instead of striding over
+// whole records; names, dates and champion usage sit in their own columns
+// and are only touched when a row is shown. Slots are never removed except
+// by clear(), and slot order is first-seen order.
+class PlayerStatsTable {
+public:
+    PlayerStatsTable() = default;
+
+    int getSize() const;
+    void reserve(int players);
+    void clear();
+
+    // Slot of playerId, or -1
+    int find(const std::string& playerId) const;
+
+    // Slot of playerId, created with playerName if new
+    int findOrAdd(const std::string& playerId, const std::string& playerName);
+
+    // Count one match for the player in slot
+    void recordMatch(int slot, bool isWin, Champion champion, const std::string& matchDate, float gameDuration);
+
+    // Whole row as a PlayerStats / replace a row (checkpoint restore)
+    PlayerStats get(int slot) const;
+    void set(int slot, const PlayerStats& stats);
+
+    const std::string& getPlayerId(int slot) const { return ids[slot]; }
+    const std::string& getPlayerName(int slot) const { return names[slot]; }
+    int getTotalMatches(int slot) const { return matches[slot]; }
+    int getWins(int slot) const { return winCounts[slot]; }
+    int getLosses(int slot) const { return lossCounts[slot]; }
+    int getCurrentWinStreak(int slot) const { return streaks[slot]; }
+    int getLongestWinStreak(int slot) const { return longestStreaks[slot]; }
+    float getWinRate(int slot) const { return winRateOf(winCounts[slot], matches[slot]); }
+    Champion getMostUsedChampion(int slot) const { return favourites[slot]; }
+    int getChampionUsage(int slot, int champion) const { return usage[slot * PlayerStats::CHAMPION_SLOTS + champion]; }
+    const std::string& getLastMatchDate(int slot) const { return lastDates[slot]; }
+    float getAverageGameDuration(int slot) const { return durations[slot]; }
+
+    // Slots with at least one match, highest win rate first (ties keep slot
+    // order); one pass over the wins / matches columns plus a sort
+    DynamicArray<int> rankByWinRate() const;
+
+    // Sum of the matches column
+    long long sumTotalMatches() const;
+
+private:
+    HashMap<std::string, int> slotById;
+
+    // Hot columns
+    DynamicArray<int> matches;
+    DynamicArray<int> winCounts;
+    DynamicArray<int> lossCounts;
+    DynamicArray<int> streaks;
+    DynamicArray<int> longestStreaks;
+
+    // Cold columns
+    DynamicArray<std::string> ids;
+    DynamicArray<std::string> names;
+    DynamicArray<Champion> favourites;
+    DynamicArray<int> usage;                // CHAMPION_SLOTS counts per slot
+    DynamicArray<std::string> lastDates;
+    DynamicArray<float> durations;
+
+    static float winRateOf(int wins, int total) {
+        return total > 0 ? (static_cast<float>(wins) / total) * 100.0f : 0.0f;
+    }
+};
+
+#endif
@@ -14,7 +14,9 @@
 #include "dto/Spectator.hpp"
 #include "structures/Queue.hpp"
 #include "structures/PriorityQueue.hpp"
+#include "structures/BucketPriorityQueue.hpp"
 #include "structures/CircularQueue.hpp"
+#include "structures/MpmcRingQueue.hpp"
 #include "structures/DoublyLinkedList.hpp"  // Needed for method signatures
 #include "../helper/JsonLoader.hpp"
 
@@ -54,6 +56,14 @@ public:
     // Enqueue for later seating
     void addToEntryQueue(const Spectator &s, bool quiet);
 
+    // Thread-safe hand-off for concurrent check-in kiosks; returns false if
+    // the kiosk ingress is full. Arrivals join the entry queue when it is
+    // next drained (processEntryQueue does this first).
+    bool submitFromKiosk(const Spectator &s);
+
+    // Move every pending kiosk arrival into the entry queue; returns the count
+    int drainKioskIngress();
+
     // Seat everyone, spilling into overflow only when all bins are full
     void processEntryQueue(bool verbose);
 
@@ -110,7 +120,8 @@ private:
     std::string generalSeatIds[5][30];
 
     // Queues
-    PriorityQueue<Spectator> entryQueue;    // Priority queue for seat assignment
+    BucketPriorityQueue<Spectator> entryQueue;  // Bucketed priority queue for seat assignment
+    MpmcRingQueue<Spectator> kioskIngress;      // Lock-free inbox filled by kiosk threads
     CircularQueue<Spectator> overflowQueue; // CircularQueue for overflow handling
     
     // Manual tracking variables for enhanced seating management
@@ -3,6 +3,7 @@
 #define FUNCTIONS_SPECTATORREGISTRATION_HPP
 
 #include <string>
+#include <nlohmann/json.hpp>
 #include "structures/DoublyLinkedList.hpp"
 #include "dto/Spectator.hpp"
 #include "functions/SeatingManager.hpp"
@@ -32,12 +33,17 @@ private:
     SeatingManager*             seatingManager;
     bool                        dataLoaded;
     int                         nextSpectatorId;
+    nlohmann::json              checkInRecords;       // In-memory copy of check_in.json
+    bool                        checkInRecordsLoaded;
     
     /// Helper function to get current date and time as string
     std::string getCurrentDateTime();
     
     /// Helper function to update check-in file with spectator data
     void updateCheckInFile(const Spectator& spectator);
+
+    /// Hand a checked-in spectator to SeatingManager through its kiosk ingress
+    void queueForSeating(const Spectator& spectator);
 };
 
 #endif // FUNCTIONS_SPECTATORREGISTRATION_HPP
@@ -4,19 +4,27 @@
 #include <string>
 #include "dto/Tournament.hpp"
 #include "structures/DoublyLinkedList.hpp"
+#include "structures/HashMap.hpp"
 #include "helper/JsonLoader.hpp"
 #include "helper/JsonWriter.hpp"
+#include "helper/FileWatch.hpp"
 
 class TournamentManager {
 private:
     DoublyLinkedList<Tournament> tournaments;
+    // Indexes into tournaments, kept in step with every append and erase
+    HashMap<std::string, DoublyLinkedList<Tournament>::Iterator> tournamentsById;
+    HashMap<std::string, DoublyLinkedList<Tournament>::Iterator> tournamentsByName;
     JsonLoader jsonLoader;
+    FileWatch tournamentsWatch{"data/tournaments.json"};
     JsonWriter jsonWriter;
     Tournament* registeringTournament;
     Tournament* ongoingTournament;
     
     // Helper methods
     void loadTournamentsFromFile();
+    void appendTournament(const Tournament& tournament);
+    void eraseTournament(DoublyLinkedList<Tournament>::Iterator position);
     bool hasDuplicateTournament(const std::string& name, const std::string& startDate, const std::string& endDate) const;
     std::string formatDate(const std::string& date) const;
     bool isValidDate(const std::string& date) const;
@@ -50,4 +50,12 @@ enum class Champion
     NoChampion // Placeholder for no champion selected
 };
 
+// On-disk encoding of the data/ snapshot files
+enum class StorageFormat
+{
+    Json,           // Pretty-printed JSON (default)
+    MessagePack,
+    Cbor
+};
+
 #endif
\ No newline at end of file
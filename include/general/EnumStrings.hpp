@@ -0,0 +1,113 @@
+#ifndef ENUM_STRINGS_HPP
+#define ENUM_STRINGS_HPP
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+#include "general/Enum.hpp"
+
+// The one name table per enum, used by every load, save and display path.
+//
+// EnumNames<E>::names lists the spellings in enumerator order, so toString()
+// is an array index returning a view of a string literal (no allocation).
+// Parsing hashes the length, first and last character into a 32-slot table
+// built at compile time; a static_assert rejects tables where two names share
+// a slot, so a lookup is one hash plus one comparison.
+
+template <typename E>
+struct EnumNames;
+
+template <>
+struct EnumNames<TournamentStage> {
+    static constexpr std::string_view names[] = {
+        "Registration", "Qualifiers", "Tiebreakers", "Quarterfinals", "Semifinals", "Finals", "Completed"
+    };
+};
+
+template <>
+struct EnumNames<TournamentCategory> {
+    static constexpr std::string_view names[] = {"Local", "Regional", "National", "International"};
+};
+
+template <>
+struct EnumNames<Gender> {
+    static constexpr std::string_view names[] = {"Male", "Female"};
+};
+
+template <>
+struct EnumNames<SpectatorType> {
+    static constexpr std::string_view names[] = {"Normal", "VIP", "Streamer", "Influencer", "Player"};
+};
+
+template <>
+struct EnumNames<Champion> {
+    static constexpr std::string_view names[] = {
+        "Akali", "Ezreal", "Fiora", "Fizz", "Garen", "Jax", "Katarina", "LeeSin", "Riven", "Yasuo", "Zed",
+        "NoChampion"
+    };
+};
+
+template <typename E>
+class EnumTable {
+public:
+    static constexpr std::size_t COUNT = std::size(EnumNames<E>::names);
+
+    static constexpr std::string_view name(E value) {
+        std::size_t index = static_cast<std::size_t>(value);
+        return index < COUNT ? EnumNames<E>::names[index] : std::string_view("Unknown");
+    }
+
+    static constexpr bool parse(std::string_view text, E& value) {
+        signed char index = SLOTS[slotOf(text)];
+        if (index < 0 || EnumNames<E>::names[index] != text) return false;
+        value = static_cast<E>(index);
+        return true;
+    }
+
+private:
+    static constexpr std::size_t SLOT_COUNT = 32;
+
+    static constexpr std::size_t slotOf(std::string_view text) {
+        if (text.empty()) return 0;
+        return (text.size() * 3 + static_cast<unsigned char>(text.front()) * 12 +
+                static_cast<unsigned char>(text.back())) % SLOT_COUNT;
+    }
+
+    static constexpr std::array<signed char, SLOT_COUNT> buildSlots() {
+        std::array<signed char, SLOT_COUNT> slots{};
+        for (std::size_t i = 0; i < SLOT_COUNT; ++i) slots[i] = -1;
+        for (std::size_t i = 0; i < COUNT; ++i) slots[slotOf(EnumNames<E>::names[i])] = static_cast<signed char>(i);
+        return slots;
+    }
+
+    static constexpr bool collisionFree() {
+        for (std::size_t i = 0; i < COUNT; ++i) {
+            if (SLOTS[slotOf(EnumNames<E>::names[i])] != static_cast<signed char>(i)) return false;
+        }
+        return true;
+    }
+
+    static constexpr std::array<signed char, SLOT_COUNT> SLOTS = buildSlots();
+    static_assert(COUNT <= SLOT_COUNT && collisionFree(), "Enum names collide in EnumTable; adjust slotOf()");
+};
+
+inline constexpr std::string_view toString(TournamentStage stage) { return EnumTable<TournamentStage>::name(stage); }
+inline constexpr std::string_view toString(TournamentCategory category) { return EnumTable<TournamentCategory>::name(category); }
+inline constexpr std::string_view toString(Gender gender) { return EnumTable<Gender>::name(gender); }
+inline constexpr std::string_view toString(SpectatorType type) { return EnumTable<SpectatorType>::name(type); }
+inline constexpr std::string_view toString(Champion champion) { return EnumTable<Champion>::name(champion); }
+
+// Parse an exact spelling into value; false (value untouched) if unknown
+template <typename E>
+constexpr bool tryEnumFromString(std::string_view text, E& value) {
+    return EnumTable<E>::parse(text, value);
+}
+
+// Parse an exact spelling, or return fallback if unknown
+template <typename E>
+constexpr E enumFromString(std::string_view text, E fallback) {
+    tryEnumFromString(text, fallback);
+    return fallback;
+}
+
+#endif
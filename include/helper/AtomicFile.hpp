@@ -0,0 +1,34 @@
+#ifndef ATOMICFILE_HPP
+#define ATOMICFILE_HPP
+
+#include <string>
+
+// Durable file updates.
+//
+// write() never truncates the live file: the new contents go to
+// "<file>.tmp", which is flushed to disk and then renamed over the original,
+// so a crash leaves either the old or the new file, never a torn one.
+// append() flushes to disk before returning. writeTemp() and commitTemp()
+// are the two halves of write(), for callers that must do something
+// between them (JsonJournal retires the journal there).
+class AtomicFile {
+public:
+    static std::string tempPath(const std::string& filename);
+
+    // Replace filename with contents (write temp + fsync + rename)
+    static bool write(const std::string& filename, const std::string& contents);
+
+    // Write contents to tempPath(filename) and fsync it
+    static bool writeTemp(const std::string& filename, const std::string& contents);
+
+    // Rename tempPath(filename) over filename; the temp file is removed on failure
+    static bool commitTemp(const std::string& filename);
+
+    // Rename from over to, durably
+    static bool rename(const std::string& from, const std::string& to);
+
+    // Append contents to filename (created if missing) and fsync
+    static bool append(const std::string& filename, const std::string& contents);
+};
+
+#endif
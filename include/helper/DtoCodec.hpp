@@ -0,0 +1,268 @@
+#ifndef DTOCODEC_HPP
+#define DTOCODEC_HPP
+
+#include <istream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <nlohmann/json.hpp>
+#include "dto/Player.hpp"
+#include "dto/Match.hpp"
+#include "dto/Performance.hpp"
+#include "dto/Result.hpp"
+#include "dto/Spectator.hpp"
+#include "dto/Tournament.hpp"
+#include "helper/SnapshotFile.hpp"
+
+// One row of a check-in file: a player plus its queue priority
+struct CheckedInRecord {
+    Player player;
+    int priority = 0;
+};
+
+// A scalar handed to a field setter. Strings are moved out, not copied.
+struct SaxScalar {
+    enum class Kind { Null, Boolean, Integer, Float, String };
+
+    Kind kind = Kind::Null;
+    bool boolean = false;
+    long long integer = 0;
+    double number = 0.0;
+    std::string* text = nullptr;
+
+    bool isString() const { return kind == Kind::String; }
+    std::string_view view() const { return text ? std::string_view(*text) : std::string_view(); }
+
+    // Numbers are accepted where the other numeric kind is expected
+    long long asInt() const {
+        return kind == Kind::Float ? static_cast<long long>(number) : (kind == Kind::Boolean ? boolean : integer);
+    }
+    double asDouble() const {
+        return kind == Kind::Float ? number : static_cast<double>(asInt());
+    }
+    bool asBool() const {
+        return kind == Kind::Boolean ? boolean : asInt() != 0;
+    }
+    void moveTo(std::string& out) {
+        if (text) out = std::move(*text);
+    }
+};
+
+// Per-DTO key dispatch. find() maps a JSON key to the setter for that field,
+// or nullptr for keys the DTO does not use. `hint` carries the index of the
+// previous match so that records written with a fixed key order resolve each
+// key with a single comparison.
+template <typename T>
+struct DtoFields {
+    using Setter = void (*)(T&, SaxScalar&);
+    static Setter find(std::string_view key, int& hint);
+};
+
+template <> DtoFields<Player>::Setter DtoFields<Player>::find(std::string_view, int&);
+template <> DtoFields<CheckedInRecord>::Setter DtoFields<CheckedInRecord>::find(std::string_view, int&);
+template <> DtoFields<Match>::Setter DtoFields<Match>::find(std::string_view, int&);
+template <> DtoFields<Performance>::Setter DtoFields<Performance>::find(std::string_view, int&);
+template <> DtoFields<Result>::Setter DtoFields<Result>::find(std::string_view, int&);
+template <> DtoFields<Spectator>::Setter DtoFields<Spectator>::find(std::string_view, int&);
+template <> DtoFields<Tournament>::Setter DtoFields<Tournament>::find(std::string_view, int&);
+
+// SAX handler that fills one T per JSON object and hands it to sink(T&&)
+// as soon as the object closes, so only one record is alive at a time.
+// Accepts either a top-level array of objects or a single object (one
+// journal line). Unknown keys and nested arrays/objects inside a record are
+// skipped.
+template <typename T, typename Sink>
+class DtoSaxHandler {
+public:
+    using json = nlohmann::json;
+
+    explicit DtoSaxHandler(Sink& sink) : sink(sink), depth(0), recordDepth(0), inRecord(false), setter(nullptr), hint(-1) {}
+
+    bool null() {
+        SaxScalar value;
+        return deliver(value);
+    }
+
+    bool boolean(bool flag) {
+        SaxScalar value;
+        value.kind = SaxScalar::Kind::Boolean;
+        value.boolean = flag;
+        return deliver(value);
+    }
+
+    bool number_integer(json::number_integer_t number) {
+        SaxScalar value;
+        value.kind = SaxScalar::Kind::Integer;
+        value.integer = number;
+        return deliver(value);
+    }
+
+    bool number_unsigned(json::number_unsigned_t number) {
+        SaxScalar value;
+        value.kind = SaxScalar::Kind::Integer;
+        value.integer = static_cast<long long>(number);
+        return deliver(value);
+    }
+
+    bool number_float(json::number_float_t number, const json::string_t&) {
+        SaxScalar value;
+        value.kind = SaxScalar::Kind::Float;
+        value.number = number;
+        return deliver(value);
+    }
+
+    bool string(json::string_t& text) {
+        SaxScalar value;
+        value.kind = SaxScalar::Kind::String;
+        value.text = &text;
+        return deliver(value);
+    }
+
+    bool binary(json::binary_t&) {
+        SaxScalar value;
+        return deliver(value);
+    }
+
+    bool start_object(std::size_t) {
+        depth++;
+        if (!inRecord) {
+            inRecord = true;
+            recordDepth = depth;
+            record = T();
+        }
+        setter = nullptr;
+        return true;
+    }
+
+    bool key(json::string_t& name) {
+        if (inRecord && depth == recordDepth) {
+            setter = DtoFields<T>::find(name, hint);
+        }
+        return true;
+    }
+
+    bool end_object() {
+        if (inRecord && depth == recordDepth) {
+            inRecord = false;
+            sink(std::move(record));
+        }
+        depth--;
+        setter = nullptr;
+        return true;
+    }
+
+    bool start_array(std::size_t) {
+        depth++;
+        setter = nullptr;
+        return true;
+    }
+
+    bool end_array() {
+        depth--;
+        return true;
+    }
+
+    bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception& ex) {
+        throw std::runtime_error(ex.what());
+    }
+
+private:
+    Sink& sink;
+    T record;
+    int depth;
+    int recordDepth;
+    bool inRecord;
+    typename DtoFields<T>::Setter setter;
+    int hint;
+
+    bool deliver(SaxScalar& value) {
+        if (inRecord && depth == recordDepth && setter) {
+            setter(record, value);
+        }
+        setter = nullptr;
+        return true;
+    }
+};
+
+// Streaming readers built on DtoSaxHandler, and the matching writers
+class DtoCodec {
+public:
+    // Parse a snapshot array (or single object) from in, calling sink(T&&)
+    // per record. Binary snapshots are detected from their header. Throws
+    // std::runtime_error on malformed input, like `in >> json`.
+    template <typename T, typename Sink>
+    static void readArray(std::istream& in, Sink&& sink) {
+        StorageFormat format = SnapshotFile::readHeader(in);
+        DtoSaxHandler<T, Sink> handler(sink);
+        nlohmann::json::sax_parse(in, &handler, SnapshotFile::inputFormat(format));
+    }
+
+    // Same over an in-memory snapshot (e.g. a MappedFile), parsing in place
+    template <typename T, typename Sink>
+    static void readBuffer(std::string_view bytes, Sink&& sink) {
+        StorageFormat format = SnapshotFile::readHeader(bytes);
+        DtoSaxHandler<T, Sink> handler(sink);
+        nlohmann::json::sax_parse(bytes.data(), bytes.data() + bytes.size(), &handler, SnapshotFile::inputFormat(format));
+    }
+
+    // Parse one journal line; returns false (and emits nothing) if it is torn
+    template <typename T, typename Sink>
+    static bool readRecord(const std::string& line, Sink&& sink) {
+        DtoSaxHandler<T, Sink> handler(sink);
+        try {
+            return nlohmann::json::sax_parse(line, &handler);
+        } catch (const std::exception&) {
+            return false;
+        }
+    }
+
+    // Encode records as a whole snapshot file. JSON is streamed straight into
+    // the output, byte-for-byte what json::dump(4) prints for the array of
+    // toJson() objects, without building that array; MessagePack and CBOR
+    // still go through it.
+    template <typename Container>
+    static std::string encodeArray(const Container& records, StorageFormat format = SnapshotFile::getFormat()) {
+        if (format != StorageFormat::Json) {
+            nlohmann::json data = nlohmann::json::array();
+            for (const auto& record : records) {
+                data.push_back(toJson(record));
+            }
+            return SnapshotFile::encode(data, format);
+        }
+
+        std::string out;
+        bool first = true;
+        for (const auto& record : records) {
+            out += first ? "[\n" : ",\n";
+            first = false;
+            appendPrettyJson(out, record);
+        }
+        out += first ? "[]" : "\n]";
+        return out;
+    }
+
+    // One record as a json object (journal lines, binary snapshots)
+    static nlohmann::json toJson(const Player& player);
+    static nlohmann::json toJson(const CheckedInRecord& record);
+    static nlohmann::json toJson(const Match& match);
+    static nlohmann::json toJson(const Performance& performance);
+    static nlohmann::json toJson(const Result& result);
+    static nlohmann::json toJson(const Spectator& spectator);
+    static nlohmann::json toJson(const Tournament& tournament);
+
+    // Append one record as an element of a dump(4) array (no separator).
+    // Throws std::runtime_error on invalid UTF-8, as dump() would.
+    static void appendPrettyJson(std::string& out, const Player& player);
+    static void appendPrettyJson(std::string& out, const CheckedInRecord& record);
+    static void appendPrettyJson(std::string& out, const Match& match);
+    static void appendPrettyJson(std::string& out, const Performance& performance);
+    static void appendPrettyJson(std::string& out, const Result& result);
+    static void appendPrettyJson(std::string& out, const Spectator& spectator);
+    static void appendPrettyJson(std::string& out, const Tournament& tournament);
+
+    // "S00042"; ids past five digits keep all their digits
+    static std::string formatSpectatorId(int id);
+};
+
+#endif
@@ -0,0 +1,94 @@
+#ifndef FILEWATCH_HPP
+#define FILEWATCH_HPP
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+// Tells a manager whether the data file it loaded has changed since, so
+// reloads can be skipped or limited to what was appended.
+//
+// A watch remembers the snapshot's size, mtime, inode and content hash and
+// how many journal bytes the caller has applied, plus the journal's inode and
+// a hash of the last few KB applied, so checking the journal costs the same
+// however long it grows. check() flushes pending saves of the file and
+// compares:
+//   - None:     nothing changed (a touched file with identical content counts
+//               as unchanged); keep the data in memory,
+//   - Appended: only new journal records; read them with
+//               JsonLoader::loadAppended*(filename, offset),
+//   - Replaced: anything else; load the whole file again.
+// After loading, the caller reports the journal offset it reached with
+// loaded(). On Linux, an inotify watch on the file's directory lets check()
+// answer None without touching the file at all while no events arrived, so
+// changes made by other processes are noticed without polling their contents.
+class FileWatch {
+public:
+    enum class Change { None, Appended, Replaced };
+
+    // The loaded state in a form that can be saved with data derived from
+    // the file and compared with a later load of it
+    struct Stamp {
+        std::uintmax_t size = 0;            // Snapshot size and content hash
+        std::uint64_t hash = 0;
+        std::uintmax_t journalOffset = 0;
+        std::uintmax_t journalInode = 0;
+        std::uint64_t journalTailHash = 0;
+
+        bool operator==(const Stamp& other) const {
+            return size == other.size && hash == other.hash && journalOffset == other.journalOffset &&
+                   journalInode == other.journalInode && journalTailHash == other.journalTailHash;
+        }
+        bool operator!=(const Stamp& other) const { return !(*this == other); }
+    };
+
+    explicit FileWatch(const std::string& filename);
+
+    const std::string& getFilename() const;
+
+    // Compare the file with what the last loaded() call recorded
+    Change check();
+
+    // Journal bytes already applied; tail reads start here
+    std::uintmax_t getJournalOffset() const;
+
+    // The caller now holds the file as seen by the last check(), journal
+    // applied up to journalOffset
+    void loaded(std::uintmax_t journalOffset);
+
+    // Forget the recorded state; the next check() reports Replaced
+    void invalidate();
+
+    // The state recorded by the last loaded(); false if there is none
+    bool getStamp(Stamp& stamp) const;
+
+    // Whether the loaded file is the stamped one, with at most journal
+    // records appended since. Reads no more than the JOURNAL_TAIL bytes
+    // before the stamped journal offset.
+    bool startsWith(const Stamp& stamp) const;
+
+    // Whether inotify is available (otherwise every check() stats the file)
+    static bool isNotifying();
+
+private:
+    static const std::uintmax_t JOURNAL_TAIL = 4096;
+
+    struct State {
+        bool valid = false;
+        bool exists = false;
+        std::uintmax_t size = 0;
+        std::uintmax_t inode = 0;
+        std::filesystem::file_time_type modified;
+        std::uint64_t hash = 0;
+        std::uintmax_t journalOffset = 0;
+        std::uintmax_t journalInode = 0;
+        std::uint64_t journalTailHash = 0;  // Bytes [journalOffset - JOURNAL_TAIL, journalOffset)
+        unsigned long long generation = 0;
+    };
+
+    std::string filename;
+    State current;      // What the caller holds
+    State observed;     // What the last check() saw; becomes current on loaded()
+};
+
+#endif
@@ -0,0 +1,113 @@
+#ifndef GROUPCOMMIT_HPP
+#define GROUPCOMMIT_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <nlohmann/json.hpp>
+#include "structures/DynamicArray.hpp"
+#include "structures/HashMap.hpp"
+#include "structures/HashSet.hpp"
+
+// Coalesces logical writes to data/ files into few physical, durable ones.
+//
+// WriteBehindCache hands its whole-file rewrites (submitSnapshot) and
+// JsonWriter its journal records (submitAppend) to the scheduler instead of
+// touching the disk. A background thread waits one commit window (5 ms by
+// default) after the first pending write, then commits everything queued for
+// each file at once: only the newest snapshot is built and written
+// (atomically, via AtomicFile), followed by every record appended after it in
+// one journal write + fsync. A burst of N rewrites of one file therefore
+// costs one fsync'd write instead of N. Snapshots are built by the committing
+// thread, so appends are ordered after them without the submitter encoding
+// anything.
+//
+// Writes are durable at most one window after they are submitted. Readers
+// call flush(filename) first so they always see their own writes, and
+// everything pending is flushed at exit. A window of zero commits each write
+// synchronously. A failed commit is queued again and retried (by the
+// background thread after RETRY_DELAY, or by the next flush), never dropped.
+// The failure is remembered until the next flush that covers the file or a
+// later successful commit of it, so a caller that waits learns about
+// failures even when the background thread did the commit. Callers that do
+// not wait collect them with takeUnreportedFailures().
+class GroupCommit {
+public:
+    // Produces a snapshot's bytes when it is committed; false if there is
+    // nothing to write (e.g. the content is unchanged)
+    using Build = std::function<bool(std::string&)>;
+
+    // Called after a snapshot commit with whether it reached the disk; not
+    // called for a snapshot superseded or skipped before it was written
+    using Completion = std::function<void(bool)>;
+
+    static GroupCommit& instance();
+
+    void setWindow(std::chrono::milliseconds window);
+    std::chrono::milliseconds getWindow() const;
+
+    // Replace filename with the bytes build() produces at commit time;
+    // supersedes anything still pending for it
+    void submitSnapshot(const std::string& filename, Build build, Completion done = nullptr);
+
+    // Journal a record for filename, after any pending snapshot
+    void submitAppend(const std::string& filename, nlohmann::json record);
+
+    // Commit now and wait; false if any write (including a background
+    // commit since the last flush) failed
+    bool flush();
+    bool flush(const std::string& filename);
+
+    // Flush and stop the background thread; later writes commit synchronously
+    void shutdown();
+
+    // Files whose commit failed, and has not succeeded since, that were not
+    // returned by an earlier call
+    DynamicArray<std::string> takeUnreportedFailures();
+
+    // Counters: logical writes submitted vs physical commits performed
+    long long getSubmittedCount() const;
+    long long getCommitCount() const;
+    long long getFailureCount() const;
+
+    GroupCommit(const GroupCommit&) = delete;
+    GroupCommit& operator=(const GroupCommit&) = delete;
+
+private:
+    static constexpr std::chrono::milliseconds RETRY_DELAY{1000};
+
+    struct PendingWrite {
+        bool hasSnapshot = false;
+        Build build;                // Set until the snapshot has been built
+        std::string snapshot;
+        Completion snapshotDone;
+        DynamicArray<nlohmann::json> appends;
+    };
+
+    mutable std::mutex stateMutex;              // Guards the fields below
+    std::mutex commitMutex;                     // Serialises physical commits
+    std::condition_variable wakeUp;
+    HashMap<std::string, PendingWrite> pending;
+    HashSet<std::string> failed;                // Files whose commit failed since their last flush
+    HashSet<std::string> unreported;            // Failed files not yet returned by takeUnreportedFailures
+    std::chrono::milliseconds window;
+    bool stopping;
+    bool running;
+    long long submitted;
+    long long commits;
+    long long failures;
+    std::thread worker;
+
+    GroupCommit();
+
+    void run();
+    bool commitAll();
+    bool commitFile(const std::string& filename);
+    bool commitPending(HashMap<std::string, PendingWrite>& batch);
+    bool commitFile(const std::string& filename, PendingWrite& write);
+};
+
+#endif
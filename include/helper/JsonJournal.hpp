@@ -0,0 +1,96 @@
+#ifndef JSONJOURNAL_HPP
+#define JSONJOURNAL_HPP
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <nlohmann/json.hpp>
+#include "structures/DynamicArray.hpp"
+
+// Append-only journal next to a JSON array file.
+//
+// Records appended to "<file>" go to "<file>.journal" as one compact JSON
+// object per line, so an append costs one short write instead of a full
+// load + rewrite. The array file stays the snapshot; readers call replay()
+// after parsing it to pick up the journaled records.
+//
+// Once the journal holds at least COMPACT_MIN_RECORDS records and is at least
+// as large as the snapshot, the next append folds it into the snapshot
+// (compact) and starts a new journal. Compaction is O(n) but happens after
+// O(n) appends, so appends stay O(1) amortised. Writers that rewrite the
+// whole snapshot go through replaceSnapshot(), since the snapshot then
+// already holds everything.
+//
+// Replacing the snapshot and dropping the journal must look like one step
+// after a crash, or the journal would be replayed on top of a snapshot that
+// already contains it. replaceSnapshot() writes "<file>.tmp", renames the
+// journal to "<file>.journal.old", renames the temp file over the snapshot
+// and only then deletes the old journal. The first time a file's journal is
+// touched, a leftover ".journal.old" is resolved: if the temp file is still
+// there the snapshot was never replaced and the journal is put back,
+// otherwise the snapshot already holds it and it is deleted.
+class JsonJournal {
+public:
+    static const int COMPACT_MIN_RECORDS = 500;
+
+    static std::string journalPath(const std::string& filename);
+    static std::string retiredJournalPath(const std::string& filename);
+
+    // Append one record; returns false if the journal could not be written.
+    // The record is on disk (fsync'd) when this returns.
+    static bool append(const std::string& filename, const nlohmann::json& record);
+
+    // Append several records with a single write + fsync
+    static bool appendBatch(const std::string& filename, const DynamicArray<nlohmann::json>& records);
+
+    // Append the journaled records of filename to data (a parsed snapshot
+    // array). Torn or unparsable lines (e.g. from a crash mid-write) are skipped.
+    static void replay(const std::string& filename, nlohmann::json& data);
+
+    // Call onLine(const std::string&) for each non-empty journal line, for
+    // readers that decode records themselves instead of building a json array
+    template <typename Fn>
+    static void forEachLine(const std::string& filename, Fn&& onLine) {
+        recover(filename);
+        std::ifstream in(journalPath(filename));
+        std::string line;
+        while (std::getline(in, line)) {
+            if (!line.empty()) onLine(line);
+        }
+    }
+
+    // Like forEachLine, but starts offset bytes into the journal and stops
+    // before a last line without its newline (still being written). Returns
+    // the offset just past the lines read, for the next call to resume from.
+    template <typename Fn>
+    static std::uintmax_t forEachLineFrom(const std::string& filename, std::uintmax_t offset, Fn&& onLine) {
+        recover(filename);
+        std::ifstream in(journalPath(filename), std::ios::binary);
+        if (!in || !in.seekg(static_cast<std::streamoff>(offset))) return offset;
+        std::string line;
+        while (std::getline(in, line) && !in.eof()) {
+            offset += line.size() + 1;
+            if (!line.empty()) onLine(line);
+        }
+        return offset;
+    }
+
+    // Fold the journal into the snapshot and remove it
+    static bool compact(const std::string& filename);
+
+    // Replace the snapshot with bytes (already encoded) and drop the journal
+    // it supersedes, crash-safely; on failure both are left as they were
+    static bool replaceSnapshot(const std::string& filename, const std::string& bytes);
+
+    // Finish or roll back a replaceSnapshot() cut short by a crash. Cheap
+    // after the first call per file; the readers above call it themselves.
+    static void recover(const std::string& filename);
+
+    // Whether a record with this "id" exists in snapshot + journal. The first
+    // call per file loads it; later calls and appends keep the set current.
+    static bool containsId(const std::string& filename, const std::string& id);
+
+    static int pendingRecords(const std::string& filename);
+};
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef JSONLOADER_HPP
 #define JSONLOADER_HPP
 
+#include <cstdint>
 #include <string>
 #include "structures/DoublyLinkedList.hpp"
 #include "structures/PriorityQueue.hpp"
@@ -11,15 +12,42 @@
 #include "dto/Spectator.hpp"
 #include "dto/Tournament.hpp"
 
+// Check-in queue, addressable by player id
+using CheckInQueue = PriorityQueue<Player, PlayerIdKey>;
+
 class JsonLoader {
 public:
-    static DoublyLinkedList<Player> loadPlayers(const std::string& filename);
-    static PriorityQueue<Player> loadCheckedInPlayers(const std::string& filename);
-    static DoublyLinkedList<Match> loadMatches(const std::string& filename);
+    // loadPlayers/loadMatches/loadResults/loadTournaments optionally report
+    // how many journal bytes they read; the matching loadAppended* decode
+    // only the journal records after that offset and advance it (see FileWatch)
+    static DoublyLinkedList<Player> loadPlayers(const std::string& filename, std::uintmax_t* journalEnd = nullptr);
+    static DoublyLinkedList<Player> loadAppendedPlayers(const std::string& filename, std::uintmax_t& journalOffset);
+    static CheckInQueue loadCheckedInPlayers(const std::string& filename);
+    static DoublyLinkedList<Match> loadMatches(const std::string& filename, std::uintmax_t* journalEnd = nullptr);
+    static DoublyLinkedList<Match> loadAppendedMatches(const std::string& filename, std::uintmax_t& journalOffset);
     static DoublyLinkedList<Performance> loadPerformances(const std::string& filename);
-    static DoublyLinkedList<Result> loadResults(const std::string& filename);
+    static DoublyLinkedList<Result> loadResults(const std::string& filename, std::uintmax_t* journalEnd = nullptr);
+    static DoublyLinkedList<Result> loadAppendedResults(const std::string& filename, std::uintmax_t& journalOffset);
     static DoublyLinkedList<Spectator> loadSpectators(const std::string& filename);
-    static DoublyLinkedList<Tournament> loadTournaments(const std::string& filename);
+    static DoublyLinkedList<Tournament> loadTournaments(const std::string& filename, std::uintmax_t* journalEnd = nullptr);
+    static DoublyLinkedList<Tournament> loadAppendedTournaments(const std::string& filename, std::uintmax_t& journalOffset);
+
+    // loadPlayers / loadAppendedPlayers without the "Loaded player" line per
+    // player, for lookups that are not a user-visible load
+    static DoublyLinkedList<Player> readPlayers(const std::string& filename, std::uintmax_t* journalEnd = nullptr);
+    static DoublyLinkedList<Player> readAppendedPlayers(const std::string& filename, std::uintmax_t& journalOffset);
+
+    // Parse a file ahead of its load* call (StartupLoader runs these on
+    // worker threads). Until clearPrefetched(), load* of the same file copies
+    // the prefetched list instead of parsing, as long as neither the file nor
+    // its journal changed on disk in between. Safe to call concurrently.
+    static void prefetchPlayers(const std::string& filename);
+    static void prefetchCheckedInPlayers(const std::string& filename);
+    static void prefetchMatches(const std::string& filename);
+    static void prefetchResults(const std::string& filename);
+    static void prefetchSpectators(const std::string& filename);
+    static void prefetchTournaments(const std::string& filename);
+    static void clearPrefetched();
 };
 
 #endif
@@ -9,14 +9,37 @@
 #include "dto/Tournament.hpp"
 #include "structures/DoublyLinkedList.hpp"
 #include "structures/PriorityQueue.hpp"
+#include "helper/JsonLoader.hpp"
 #include <nlohmann/json.hpp>
 #include <string>
 
+// writeAll* copies the collection and marks the file dirty in
+// WriteBehindCache; append* journals through GroupCommit. Either way the data
+// reaches the disk (atomically, fsync'd) in the background, and JsonLoader
+// writes out a file's pending saves before reading it. Failed commits are
+// retried in the background and reported by reportFailedSaves(), which the
+// menus call before each prompt; a true return only means the save was
+// queued, so callers that must know it reached the disk call flush().
 class JsonWriter {
 public:
+    // Storage format for whole-file writes (loaders detect it per file)
+    static void setStorageFormat(StorageFormat format);
+    static StorageFormat getStorageFormat();
+
+    // Write filename's pending saves to disk and wait; false if any of them
+    // (including ones already committed in the background) failed
+    static bool flush(const std::string& filename);
+
+    // Print a warning for each file whose save has failed since the last
+    // call and not succeeded since; never waits for the disk
+    static void reportFailedSaves();
+
+    // Fold any journal into the snapshot and re-encode it in format
+    static bool convertFile(const std::string& filename, StorageFormat format);
+
     // Player operations
     static bool appendPlayer(const Player& player, const std::string& filename = "data/players.json");
-    static bool writeAllCheckedInPlayer(PriorityQueue<Player>& checkInQueue, const std::string& filename = "data/check_in.json");
+    static bool writeAllCheckedInPlayer(CheckInQueue& checkInQueue, const std::string& filename = "data/check_in.json");
     static bool writeAllPlayers(const DoublyLinkedList<Player>& players, const std::string& filename = "data/players.json");
     
     // Match operations
@@ -39,25 +62,10 @@ public:
     static bool appendTournament(const Tournament& tournament, const std::string& filename = "data/tournaments.json");
     static bool writeAllTournaments(const DoublyLinkedList<Tournament>& tournaments, const std::string& filename = "data/tournaments.json");
 
-    // Champion conversion helper
-    static std::string championToString(Champion champion);
-    static std::string genderToString(Gender gender);
-    static std::string spectatorTypeToString(SpectatorType type);
-    static std::string tournamentStageToString(TournamentStage stage);
-    static std::string tournamentCategoryToString(TournamentCategory category);
 private:
     // Helper functions
     static bool createFileIfNotExists(const std::string& filename);
     static bool createDirectoryIfNotExists(const std::string& path);
-    
-    // Conversion functions
-    static nlohmann::json playerToJson(const Player& player);
-    static nlohmann::json matchToJson(const Match& match);
-    static nlohmann::json performanceToJson(const Performance& performance);
-    static nlohmann::json resultToJson(const Result& result);
-    static nlohmann::json spectatorToJson(const Spectator& spectator);
-    static nlohmann::json tournamentToJson(const Tournament& tournament);
-    
 };
 
 #endif
@@ -0,0 +1,50 @@
+#ifndef MAPPEDFILE_HPP
+#define MAPPEDFILE_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// Read-only view of a whole file.
+//
+// The file is memory-mapped (mmap on POSIX, a file mapping on Windows) so
+// parsers can run straight over the page cache without copying through
+// iostream buffers. If mapping is not possible the file is read into an owned
+// buffer instead; callers see the same data()/size() either way.
+class MappedFile {
+public:
+    MappedFile();
+    explicit MappedFile(const std::string& filename);
+    ~MappedFile();
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // Map filename, replacing whatever was open; false if it cannot be read
+    bool open(const std::string& filename);
+    void close();
+
+    bool isOpen() const { return opened; }
+    bool isMapped() const { return mapping != nullptr; }
+    const char* data() const { return bytes; }
+    std::size_t size() const { return length; }
+    const char* begin() const { return bytes; }
+    const char* end() const { return bytes + length; }
+    std::string_view view() const { return std::string_view(bytes, length); }
+
+private:
+    const char* bytes;
+    std::size_t length;
+    bool opened;
+    void* mapping;          // Base of the mapped region, nullptr if not mapped
+#ifdef _WIN32
+    void* mappingHandle;
+#endif
+    std::string fallback;   // Owned copy when the file could not be mapped
+
+    void swap(MappedFile& other) noexcept;
+};
+
+#endif
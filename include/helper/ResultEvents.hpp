@@ -0,0 +1,26 @@
+#ifndef RESULTEVENTS_HPP
+#define RESULTEVENTS_HPP
+
+#include <functional>
+#include <string>
+#include "dto/Result.hpp"
+
+// In-process notifications for match results saved through this program.
+//
+// Whoever appends a result to a results file publishes it here once the
+// append has been handed to JsonWriter; anything holding results in memory
+// (ResultStore, statistics) subscribes and applies the record straight away
+// instead of re-reading the file. Listeners run synchronously on the
+// publishing thread, in subscription order.
+class ResultEvents {
+public:
+    using Listener = std::function<void(const std::string& filename, const Result& result)>;
+
+    // Returns an id for unsubscribe()
+    static int subscribe(Listener listener);
+    static void unsubscribe(int id);
+
+    static void publish(const std::string& filename, const Result& result);
+};
+
+#endif
@@ -0,0 +1,147 @@
+#ifndef RESULTJOIN_HPP
+#define RESULTJOIN_HPP
+
+#include <iterator>
+#include <string>
+#include "dto/Match.hpp"
+#include "dto/Player.hpp"
+#include "dto/Result.hpp"
+#include "structures/ChunkedLog.hpp"
+#include "structures/DynamicArray.hpp"
+#include "structures/HashMap.hpp"
+#include "helper/FileWatch.hpp"
+#include "helper/ResultStore.hpp"
+
+// One result resolved to its match and players. match / player1 / player2
+// are nullptr when the id is not known; all pointers stay valid until the
+// next ResultJoin::sync().
+struct JoinedRow {
+    const Result* result = nullptr;
+    const Match* match = nullptr;
+    const Player* player1 = nullptr;
+    const Player* player2 = nullptr;
+
+    bool player1Won() const { return match && result->winnerId == match->player1; }
+    bool player2Won() const { return match && result->winnerId == match->player2; }
+
+    bool involves(const std::string& playerId) const {
+        return match && (match->player1 == playerId || match->player2 == playerId);
+    }
+};
+
+// Hash join of results against matches.json and players.json.
+//
+// Matches and players are loaded once into arrays indexed by id and reloaded
+// (or extended by their journal tail) only when FileWatch reports a change,
+// so resolving a result is two O(1) lookups. Rows are produced on the fly by
+// an iterator over the ResultStore; nothing is materialised per result
+// except the per-player and per-tournament position lists, which are
+// extended as results are appended and rebuilt only after a reload.
+// Match ids are expected to be unique; if a file repeats one, the last
+// match with that id wins.
+class ResultJoin {
+public:
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = JoinedRow;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = JoinedRow;
+
+        Iterator(const ResultJoin* join = nullptr, int index = 0) : join(join), index(index) {}
+
+        JoinedRow operator*() const { return join->row(index); }
+
+        Iterator& operator++() { ++index; return *this; }
+        Iterator operator++(int) { Iterator copy = *this; ++index; return copy; }
+
+        bool operator==(const Iterator& other) const { return index == other.index; }
+        bool operator!=(const Iterator& other) const { return index != other.index; }
+
+    private:
+        const ResultJoin* join;
+        int index;
+    };
+
+    // Every result in file order, joined
+    class Rows {
+    public:
+        Rows(const ResultJoin* join, int size) : join(join), size(size) {}
+        Iterator begin() const { return Iterator(join, 0); }
+        Iterator end() const { return Iterator(join, size); }
+        int getSize() const { return size; }
+
+    private:
+        const ResultJoin* join;
+        int size;
+    };
+
+    explicit ResultJoin(ResultStore& results, const std::string& matchesFile = "data/matches.json",
+                        const std::string& playersFile = "data/players.json");
+
+    // Bring results, matches and players up to date and extend the indexes
+    void sync();
+
+    // Extend the indexes over results the store already holds (e.g. one
+    // just published), without checking any file
+    void extend();
+
+    // sync(), then iterate every result
+    Rows rows();
+
+    // The results joined so far (no sync)
+    Rows joinedRows() const;
+
+    // Result at position index of the store, joined (no sync)
+    JoinedRow row(int index) const;
+    JoinedRow join(const Result& result) const;
+
+    // What matches and players were loaded from
+    const FileWatch& getMatchesWatch() const;
+    const FileWatch& getPlayersWatch() const;
+
+    const Match* findMatch(const std::string& matchId) const;
+    const Player* findPlayer(const std::string& playerId) const;
+
+    // sync(), then the positions (for row()) of the results a player played
+    // in / of a tournament's matches, oldest first
+    const DynamicArray<int>& resultsOfPlayer(const std::string& playerId);
+    const DynamicArray<int>& resultsOfTournament(const std::string& tournamentId);
+
+    // Results whose match id is not in matches.json (as of the last sync),
+    // in total and among the first `count` positions
+    int getUnmatchedCount() const;
+    int getUnmatchedCount(int count) const;
+
+    // Bumped whenever joined rows are rebuilt from the start; between two
+    // bumps rows are only ever appended
+    long long getGeneration() const;
+
+private:
+    ResultStore& results;
+    FileWatch matchesWatch;
+    FileWatch playersWatch;
+    DynamicArray<Match> matches;
+    HashMap<std::string, int> matchIndexById;
+    DynamicArray<Player> players;
+    HashMap<std::string, int> playerIndexById;
+
+    // Per-player / per-tournament positions of the first joinedCount results
+    HashMap<std::string, DynamicArray<int>> byPlayer;
+    HashMap<std::string, DynamicArray<int>> byTournament;
+    DynamicArray<int> unmatched;    // Positions whose match is unknown
+    int joinedCount;
+    long long joinedGeneration;
+    long long generation;
+
+    static const DynamicArray<int> NO_RESULTS;
+
+    bool syncMatches(const ChunkedLog<Result>& log);
+    void syncPlayers();
+    bool addMatch(Match&& match);
+    void addPlayer(Player&& player);
+    void resetIndexes();
+};
+
+#endif
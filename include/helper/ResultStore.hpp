@@ -0,0 +1,79 @@
+#ifndef RESULTSTORE_HPP
+#define RESULTSTORE_HPP
+
+#include <cstdint>
+#include <string>
+#include "dto/Result.hpp"
+#include "structures/ChunkedLog.hpp"
+#include "structures/DynamicArray.hpp"
+#include "structures/HashMap.hpp"
+#include "helper/FileWatch.hpp"
+
+// Resident copy of a results file, loaded once and kept in step with it.
+//
+// Results live in a ChunkedLog (they never move once stored), indexed by
+// result id, match id and winner id. Every query first asks the FileWatch
+// whether the file changed: usually it has not and the query is served from
+// memory (a hit); new journal records are read from the tail; anything else
+// reloads the file. Results this process saves arrive through ResultEvents
+// and are stored at once; the tail read that follows skips them by id.
+// refresh() forces a full reload.
+class ResultStore {
+public:
+    struct Counters {
+        long long hits = 0;         // Queries answered without reading the file
+        long long reloads = 0;      // Full loads of the file
+        long long tailReads = 0;    // Reads of appended journal records only
+        long long notified = 0;     // Results received through ResultEvents
+    };
+
+    explicit ResultStore(const std::string& filename = "data/results.json");
+    ~ResultStore();
+
+    ResultStore(const ResultStore&) = delete;
+    ResultStore& operator=(const ResultStore&) = delete;
+
+    const std::string& getFilename() const;
+
+    // What the resident results were loaded from
+    const FileWatch& getWatch() const;
+
+    // All results in file order, brought up to date with the file first
+    const ChunkedLog<Result>& current();
+
+    // The same, as of the last check (no file access)
+    const ChunkedLog<Result>& resident() const;
+
+    // Lookups; nullptr / empty when absent. Pointers stay valid until the
+    // next reload.
+    const Result* findById(const std::string& id);
+    const Result* findByMatchId(const std::string& matchId);    // First result for the match
+    int indexOfMatchId(const std::string& matchId);             // Its position in current(), or -1
+    DynamicArray<const Result*> findByWinner(const std::string& winnerId);
+
+    // Drop everything and load the file again
+    void refresh();
+
+    Counters getCounters() const;
+
+    // Bumped whenever stored results are dropped (reloads); between two
+    // bumps results are only ever appended, so indexes built over current()
+    // can be extended from their last size
+    long long getGeneration() const;
+
+private:
+    FileWatch watch;
+    ChunkedLog<Result> results;
+    HashMap<std::string, int> indexById;
+    HashMap<std::string, int> indexByMatchId;
+    HashMap<std::string, DynamicArray<int>> indexByWinner;
+    Counters counters;
+    long long generation;
+    int subscription;
+
+    void sync();
+    void add(Result&& result);
+    void clear();
+};
+
+#endif
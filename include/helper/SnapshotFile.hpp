@@ -0,0 +1,53 @@
+#ifndef SNAPSHOTFILE_HPP
+#define SNAPSHOTFILE_HPP
+
+#include <istream>
+#include <string>
+#include <string_view>
+#include <nlohmann/json.hpp>
+#include "general/Enum.hpp"
+
+// Reads and writes whole data/ snapshot files in any StorageFormat.
+//
+// Binary snapshots start with a 6-byte header: the magic "ECMB", a version
+// byte and a format byte, followed by a single MessagePack or CBOR value.
+// JSON snapshots have no header (valid JSON never starts with 'E'), so
+// readers tell the formats apart from the first byte and existing files keep
+// loading unchanged. File names stay the same whatever the format.
+class SnapshotFile {
+public:
+    static const int HEADER_SIZE = 6;
+    static const unsigned char VERSION = 1;
+
+    // Format used for whole-file writes; reads always auto-detect
+    static void setFormat(StorageFormat format);
+    static StorageFormat getFormat();
+
+    // "json", "msgpack" or "cbor"; returns false for anything else
+    static bool parseFormatName(const std::string& name, StorageFormat& format);
+    static const char* formatName(StorageFormat format);
+    static nlohmann::json::input_format_t inputFormat(StorageFormat format);
+
+    // Consume the binary header, if any, and return the format of the rest
+    // of the stream. Throws std::runtime_error on an unknown header.
+    static StorageFormat readHeader(std::istream& in);
+
+    // Same for an in-memory (e.g. mapped) snapshot: strips the header from bytes
+    static StorageFormat readHeader(std::string_view& bytes);
+
+    // Parse the whole file into data; false if it is missing or unparsable
+    static bool read(const std::string& filename, nlohmann::json& data);
+
+    // Encoded file contents, header included
+    static std::string encode(const nlohmann::json& data, StorageFormat format);
+
+    // Replace the file with data, encoded in getFormat() or the given format.
+    // Goes through AtomicFile, so a crash never leaves a half-written file.
+    static bool write(const std::string& filename, const nlohmann::json& data);
+    static bool write(const std::string& filename, const nlohmann::json& data, StorageFormat format);
+
+    // Re-encode an existing file in place
+    static bool convert(const std::string& filename, StorageFormat format);
+};
+
+#endif
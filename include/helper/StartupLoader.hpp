@@ -0,0 +1,43 @@
+#ifndef STARTUPLOADER_HPP
+#define STARTUPLOADER_HPP
+
+#include <string>
+#include "structures/DynamicArray.hpp"
+
+// Parses the data files the global managers read at startup in parallel.
+//
+// The globals in main.cpp each load their files one after another in their
+// constructors (players, registrations, check-in queue, tournaments several
+// times over, results, spectators, matches). Constructing a StartupLoader
+// first fans those parses out over a small thread pool via the JsonLoader
+// prefetch cache and joins before returning, so the constructors that follow
+// copy ready-made lists instead of parsing. The time taken per file is
+// printed once all workers have finished.
+class StartupLoader {
+public:
+    using PrefetchFn = void (*)(const std::string&);
+
+    struct Task {
+        std::string filename;
+        PrefetchFn prefetch = nullptr;
+        double milliseconds = 0;    // Filled in by run()
+        bool missing = false;
+        bool failed = false;
+    };
+
+    // Prefetch the default startup files and print the timing report
+    StartupLoader();
+
+    // Prefetch the given files on up to threadCount threads (0 = one per core)
+    // and return how long the whole batch took in milliseconds
+    static double run(DynamicArray<Task>& tasks, unsigned threadCount = 0);
+
+    static void printReport(const DynamicArray<Task>& tasks, double totalMilliseconds, unsigned threadCount);
+
+    // The files main.cpp's globals load during construction
+    static DynamicArray<Task> defaultTasks();
+
+    static unsigned threadsFor(int taskCount, unsigned requested = 0);
+};
+
+#endif
@@ -0,0 +1,95 @@
+#ifndef WRITEBEHINDCACHE_HPP
+#define WRITEBEHINDCACHE_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "structures/HashMap.hpp"
+#include "structures/HashSet.hpp"
+
+// Write-behind layer for whole-file saves.
+//
+// Instead of serialising and writing a collection on every change, callers
+// mark the file dirty with a snapshot function (which owns a copy of the
+// data and returns the encoded file). A background thread hands the dirty
+// snapshots to GroupCommit at most maxStaleness after the first change, and
+// GroupCommit's thread builds each one when it commits it, so:
+//   - repeated saves of the same file before a flush collapse into one,
+//   - a snapshot whose content hash matches the last one committed is skipped,
+//   - the calling thread never encodes the data or touches the disk.
+//
+// flush(filename) pushes a file all the way to disk (JsonLoader does this
+// before reading). submit(filename) only hands a pending snapshot, unbuilt,
+// to GroupCommit; JsonWriter calls it before journaling an append so that
+// the append is ordered after the snapshot. Everything is flushed at exit.
+//
+// flush() returns false if a snapshot could not be built or committed since
+// the file was last flushed, including failures on the background threads.
+class WriteBehindCache {
+public:
+    using Snapshot = std::function<std::string()>;
+
+    struct Counters {
+        long long marked = 0;       // markDirty calls
+        long long coalesced = 0;    // Saves replaced by a newer one before flushing
+        long long unchanged = 0;    // Snapshots skipped because the content was unchanged
+        long long written = 0;      // Snapshots committed to disk
+        long long failed = 0;       // Snapshots that could not be built or committed
+    };
+
+    static WriteBehindCache& instance();
+
+    void setMaxStaleness(std::chrono::milliseconds staleness);
+    std::chrono::milliseconds getMaxStaleness() const;
+
+    // Replace filename's contents with snapshot() at the next flush
+    void markDirty(const std::string& filename, Snapshot snapshot);
+    bool isDirty(const std::string& filename) const;
+
+    // Hand filename's pending snapshot (if any) to GroupCommit now
+    void submit(const std::string& filename);
+
+    // Drop filename's pending snapshot; a direct write is replacing it
+    void discard(const std::string& filename);
+
+    // Write everything (or one file) to disk and wait
+    bool flush();
+    bool flush(const std::string& filename);
+
+    // Flush and stop the background thread; later saves are written at once
+    void shutdown();
+
+    Counters getCounters() const;
+
+    WriteBehindCache(const WriteBehindCache&) = delete;
+    WriteBehindCache& operator=(const WriteBehindCache&) = delete;
+
+private:
+    mutable std::mutex stateMutex;      // Guards dirty, lastHash, generation, failed, counters, flags
+    std::mutex handOffMutex;            // Keeps snapshot hand-offs in mark order
+    std::condition_variable wakeUp;
+    HashMap<std::string, Snapshot> dirty;
+    HashMap<std::string, std::uint64_t> lastHash;       // Content of the last committed snapshot
+    HashMap<std::string, long long> generation;         // Bumped when the file changes behind the cache
+    HashSet<std::string> failed;                        // Files whose snapshot failed to build
+    std::chrono::milliseconds maxStaleness;
+    bool stopping;
+    bool running;
+    Counters counters;
+    std::thread worker;
+
+    WriteBehindCache();
+
+    void run();
+    void submitAll();
+    void submitPending(const std::string& filename);
+    void handOff(const std::string& filename, Snapshot snapshot);
+    bool build(const std::string& filename, const Snapshot& snapshot, std::string& data, std::uint64_t& hash);
+    void committed(const std::string& filename, std::uint64_t hash, long long handedIn, bool ok);
+};
+
+#endif
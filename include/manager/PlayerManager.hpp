@@ -3,13 +3,23 @@
 
 #include "dto/Player.hpp"
 #include "structures/DoublyLinkedList.hpp"
+#include "structures/HashMap.hpp"
+#include "helper/FileWatch.hpp"
 #include <string>
 
 class PlayerManager {
 private:
     DoublyLinkedList<Player> allPlayers;
+    HashMap<std::string, DoublyLinkedList<Player>::Iterator> playersById;  // Index into allPlayers
     bool dataLoaded;
     const std::string filename = "data/players.json";
+    FileWatch playersWatch{filename};   // Skips reloads while players.json is unchanged
+
+    // Rebuild playersById from allPlayers
+    void rebuildIndex();
+
+    // Bring allPlayers up to date with the file: nothing, the appended tail, or everything
+    bool refreshFromFile();
 
 public:
     PlayerManager();
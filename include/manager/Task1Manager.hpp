@@ -20,6 +20,7 @@ private:
     DynamicArray<Match> allMatches;
     DynamicArray<Player> advancedPlayers;
     std::string currentTournamentId;
+    mutable int nextResultNumber;  // Next R-number to hand out; 0 = read results.json first
 
 public:
     // Constructor
@@ -24,7 +24,7 @@ public:
     void checkInPlayer();
     void withdrawPlayer();
     void displayCheckInQueue();
-    PriorityQueue<Player> endCurrentTournamentRegistration();
+    CheckInQueue endCurrentTournamentRegistration();
     
     // Additional utility functions
     void displayMenu();
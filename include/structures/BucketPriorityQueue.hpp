@@ -0,0 +1,132 @@
+#ifndef BUCKET_PRIORITY_QUEUE_HPP
+#define BUCKET_PRIORITY_QUEUE_HPP
+
+#include <iostream>
+#include <utility>
+#include "DynamicArray.hpp"
+
+// Priority queue for a small, fixed range of integer priorities.
+// Each priority owns a FIFO bucket, so enqueue is O(1) and dequeue is O(1)
+// apart from skipping empty buckets (bounded by the number of priorities).
+// Higher priorities come out first; equal priorities come out in arrival order.
+// Priorities outside [minPriority, maxPriority] are clamped into range.
+template <typename T>
+class BucketPriorityQueue {
+private:
+    struct Bucket {
+        DynamicArray<T> items;
+        int head;  // Index of the oldest item still queued
+
+        Bucket() : items(), head(0) {}
+        int count() const { return items.getSize() - head; }
+    };
+
+    int minPriority;
+    int bucketCount;
+    DynamicArray<Bucket> buckets;  // buckets[p - minPriority]
+    int topBucket;                 // Highest bucket that may be non-empty, -1 if none
+    int size;
+
+    int bucketIndex(int priority) const {
+        if (priority < minPriority) priority = minPriority;
+        if (priority >= minPriority + bucketCount) priority = minPriority + bucketCount - 1;
+        return priority - minPriority;
+    }
+
+    // Lower topBucket past any buckets that have been drained
+    void settleTop() {
+        while (topBucket >= 0 && buckets[topBucket].count() == 0) {
+            Bucket& bucket = buckets[topBucket];
+            bucket.items.clear();
+            bucket.head = 0;
+            topBucket--;
+        }
+    }
+
+public:
+    BucketPriorityQueue(int minPriority = 0, int maxPriority = 4)
+        : minPriority(minPriority),
+          bucketCount(maxPriority >= minPriority ? maxPriority - minPriority + 1 : 1),
+          buckets(bucketCount), topBucket(-1), size(0) {
+        for (int i = 0; i < bucketCount; ++i) {
+            buckets.emplace_back();
+        }
+    }
+
+    void enqueue(const T& item, int priority) {
+        enqueue(T(item), priority);
+    }
+
+    void enqueue(T&& item, int priority) {
+        int index = bucketIndex(priority);
+        buckets[index].items.push_back(std::move(item));
+        if (index > topBucket) topBucket = index;
+        size++;
+    }
+
+    // Removes the oldest item of the highest non-empty priority
+    T dequeue() {
+        settleTop();
+        if (topBucket < 0) return T();
+
+        Bucket& bucket = buckets[topBucket];
+        T item = std::move(bucket.items[bucket.head]);
+        bucket.head++;
+        size--;
+
+        // Drop the consumed prefix once it dominates the bucket
+        if (bucket.head * 2 >= bucket.items.getSize()) {
+            if (bucket.count() == 0) {
+                bucket.items.clear();
+            } else {
+                DynamicArray<T> remaining(bucket.count());
+                for (int i = bucket.head; i < bucket.items.getSize(); ++i) {
+                    remaining.push_back(std::move(bucket.items[i]));
+                }
+                bucket.items = std::move(remaining);
+            }
+            bucket.head = 0;
+        }
+        return item;
+    }
+
+    T peek() const {
+        for (int i = topBucket; i >= 0; --i) {
+            if (buckets[i].count() > 0) {
+                return buckets[i].items[buckets[i].head];
+            }
+        }
+        return T();
+    }
+
+    bool isEmpty() const { return size == 0; }
+    bool isFull() const { return false; }
+    int getSize() const { return size; }
+
+    void clear() {
+        for (int i = 0; i < bucketCount; ++i) {
+            buckets[i].items.clear();
+            buckets[i].head = 0;
+        }
+        topBucket = -1;
+        size = 0;
+    }
+
+    // Display all items in dequeue order
+    void display() const {
+        if (isEmpty()) {
+            std::cout << "Priority Queue is empty.\n";
+            return;
+        }
+        std::cout << "Priority Queue contents (Priority: Data):\n";
+        for (int i = topBucket; i >= 0; --i) {
+            const Bucket& bucket = buckets[i];
+            for (int j = bucket.head; j < bucket.items.getSize(); ++j) {
+                std::cout << "Priority " << (i + minPriority) << ": " << bucket.items[j] << "\n";
+            }
+        }
+        std::cout << "Total items: " << size << "\n";
+    }
+};
+
+#endif
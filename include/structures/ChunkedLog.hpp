@@ -0,0 +1,224 @@
+#ifndef CHUNKED_LOG_HPP
+#define CHUNKED_LOG_HPP
+
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "DynamicArray.hpp"
+
+// Append-only log stored in fixed-size chunks of CHUNK_SIZE records.
+// Records never move once appended (a chunk is never reallocated), so
+// pointers and references stay valid until the record is evicted or the log
+// is cleared. Append and index are O(1); iteration runs forwards or backwards
+// through each chunk sequentially.
+//
+// With a record limit the log is memory-bounded: when a new chunk is needed
+// and the limit would be exceeded, the oldest whole chunk is dropped and its
+// memory reused for the new one. At least maxRecords of the newest records
+// are always kept. Index 0 is always the oldest record still held.
+template <typename T, int CHUNK_SIZE = 256>
+class ChunkedLog {
+    static_assert(CHUNK_SIZE > 0 && (CHUNK_SIZE & (CHUNK_SIZE - 1)) == 0,
+                  "CHUNK_SIZE must be a power of two");
+
+private:
+    DynamicArray<T*> chunks;  // Oldest first; all but the last are full
+    int size;
+    int maxChunks;            // 0 = unbounded
+    long long evicted;        // Records dropped by the bound
+
+    static T* allocateChunk() {
+        return static_cast<T*>(::operator new(sizeof(T) * CHUNK_SIZE));
+    }
+
+    static void destroyChunk(T* chunk, int count) {
+        for (int i = 0; i < count; ++i) {
+            chunk[i].~T();
+        }
+    }
+
+    // Storage for the next record, starting (or recycling) a chunk if needed
+    T* nextSlot() {
+        int offset = size & (CHUNK_SIZE - 1);
+        if (offset == 0 && size / CHUNK_SIZE == chunks.getSize()) {
+            if (maxChunks > 0 && chunks.getSize() == maxChunks) {
+                T* oldest = chunks[0];
+                destroyChunk(oldest, CHUNK_SIZE);
+                chunks.erase(0);
+                chunks.push_back(oldest);
+                size -= CHUNK_SIZE;
+                evicted += CHUNK_SIZE;
+            } else {
+                chunks.push_back(allocateChunk());
+            }
+        }
+        return chunks[size / CHUNK_SIZE] + offset;
+    }
+
+    template <bool IsConst>
+    class BasicIterator {
+    private:
+        using LogPtr = typename std::conditional<IsConst, const ChunkedLog*, ChunkedLog*>::type;
+        friend class ChunkedLog;
+
+        LogPtr log;
+        int index;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+        using reference = typename std::conditional<IsConst, const T&, T&>::type;
+
+        BasicIterator(LogPtr log = nullptr, int index = 0) : log(log), index(index) {}
+
+        // Allow Iterator -> ConstIterator
+        template <bool OtherConst, typename = typename std::enable_if<IsConst && !OtherConst>::type>
+        BasicIterator(const BasicIterator<OtherConst>& other) : log(other.log), index(other.index) {}
+
+        reference operator*() const { return (*log)[index]; }
+        pointer operator->() const { return &(*log)[index]; }
+
+        BasicIterator& operator++() { ++index; return *this; }
+        BasicIterator operator++(int) { BasicIterator copy = *this; ++index; return copy; }
+        BasicIterator& operator--() { --index; return *this; }
+        BasicIterator operator--(int) { BasicIterator copy = *this; --index; return copy; }
+
+        bool operator==(const BasicIterator& other) const { return index == other.index; }
+        bool operator!=(const BasicIterator& other) const { return index != other.index; }
+
+        template <bool> friend class BasicIterator;
+    };
+
+public:
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+    using reverse_iterator = std::reverse_iterator<Iterator>;
+    using const_reverse_iterator = std::reverse_iterator<ConstIterator>;
+
+    // maxRecords <= 0 keeps everything
+    explicit ChunkedLog(int maxRecords = 0)
+        : chunks(), size(0),
+          maxChunks(maxRecords > 0 ? (maxRecords + CHUNK_SIZE - 1) / CHUNK_SIZE + 1 : 0),
+          evicted(0) {}
+
+    ChunkedLog(const ChunkedLog&) = delete;
+    ChunkedLog& operator=(const ChunkedLog&) = delete;
+
+    ChunkedLog(ChunkedLog&& other) noexcept
+        : chunks(std::move(other.chunks)), size(other.size),
+          maxChunks(other.maxChunks), evicted(other.evicted) {
+        other.size = 0;
+        other.evicted = 0;
+    }
+
+    ChunkedLog& operator=(ChunkedLog&& other) noexcept {
+        if (this != &other) {
+            release();
+            chunks = std::move(other.chunks);
+            size = other.size;
+            maxChunks = other.maxChunks;
+            evicted = other.evicted;
+            other.size = 0;
+            other.evicted = 0;
+        }
+        return *this;
+    }
+
+    ~ChunkedLog() {
+        release();
+    }
+
+    void append(const T& record) {
+        emplace(record);
+    }
+
+    void append(T&& record) {
+        emplace(std::move(record));
+    }
+
+    // Construct a record in place at the end; the reference stays valid
+    // until the record is evicted or the log cleared
+    template <typename... Args>
+    T& emplace(Args&&... args) {
+        T* slot = nextSlot();
+        ::new (static_cast<void*>(slot)) T(std::forward<Args>(args)...);
+        ++size;
+        return *slot;
+    }
+
+    T& operator[](int index) {
+        return chunks[index / CHUNK_SIZE][index & (CHUNK_SIZE - 1)];
+    }
+
+    const T& operator[](int index) const {
+        return chunks[index / CHUNK_SIZE][index & (CHUNK_SIZE - 1)];
+    }
+
+    T& at(int index) {
+        if (index < 0 || index >= size) {
+            throw std::out_of_range("ChunkedLog index out of range");
+        }
+        return (*this)[index];
+    }
+
+    const T& at(int index) const {
+        if (index < 0 || index >= size) {
+            throw std::out_of_range("ChunkedLog index out of range");
+        }
+        return (*this)[index];
+    }
+
+    T& back() { return at(size - 1); }
+    const T& back() const { return at(size - 1); }
+    T& front() { return at(0); }
+    const T& front() const { return at(0); }
+
+    // Drop all records but keep the first chunk for reuse
+    void clear() {
+        for (int c = 0; c < chunks.getSize(); ++c) {
+            int count = size - c * CHUNK_SIZE;
+            destroyChunk(chunks[c], count < CHUNK_SIZE ? count : CHUNK_SIZE);
+            if (c > 0) ::operator delete(chunks[c]);
+        }
+        if (chunks.getSize() > 1) {
+            T* first = chunks[0];
+            chunks.clear();
+            chunks.push_back(first);
+        }
+        size = 0;
+    }
+
+    int getSize() const { return size; }
+    bool isEmpty() const { return size == 0; }
+    int getChunkCount() const { return chunks.getSize(); }
+    bool isBounded() const { return maxChunks > 0; }
+
+    // Records appended over the log's lifetime / dropped by the bound
+    long long getTotalAppended() const { return evicted + size; }
+    long long getEvictedCount() const { return evicted; }
+
+    Iterator begin() { return Iterator(this, 0); }
+    Iterator end() { return Iterator(this, size); }
+    ConstIterator begin() const { return ConstIterator(this, 0); }
+    ConstIterator end() const { return ConstIterator(this, size); }
+
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+private:
+    void release() {
+        clear();
+        for (int c = 0; c < chunks.getSize(); ++c) {
+            ::operator delete(chunks[c]);
+        }
+        chunks.clear();
+    }
+};
+
+#endif
@@ -3,8 +3,15 @@
 // added functional header for std::function
 #include <iostream>
 #include <functional>
+#include <iterator>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include "NodePool.hpp"
 
-template <typename T>
+// NodeAlloc selects where nodes come from; the default NodePool keeps each
+// list's nodes in a few contiguous chunks (see NodePool.hpp).
+template <typename T, template <typename> class NodeAlloc = NodePool>
 class DoublyLinkedList {
 private:
     struct Node {
@@ -13,24 +20,152 @@ private:
         Node* next;
 
         Node(const T& value) : data(value), prev(nullptr), next(nullptr) {}
+        Node(T&& value) : data(std::move(value)), prev(nullptr), next(nullptr) {}
     };
 
+    NodeAlloc<Node> pool;
+
     Node* head;
     Node* tail;
     int size;
 
+    // Finger cursor: the last node reached through get(), so that sequential
+    // get(i), get(i + 1), get(i - 1) calls only move one hop instead of
+    // walking from the head every time.
+    mutable Node* finger;
+    mutable int fingerIndex;
+
+    // Locate the node at index by walking from whichever of head, tail or
+    // the finger is closest. Caller guarantees 0 <= index < size.
+    Node* nodeAt(int index) const {
+        Node* current = head;
+        int currentIndex = 0;
+        int bestDistance = index;
+
+        if (size - 1 - index < bestDistance) {
+            current = tail;
+            currentIndex = size - 1;
+            bestDistance = size - 1 - index;
+        }
+        if (finger) {
+            int fingerDistance = index > fingerIndex ? index - fingerIndex : fingerIndex - index;
+            if (fingerDistance < bestDistance) {
+                current = finger;
+                currentIndex = fingerIndex;
+            }
+        }
+
+        while (currentIndex < index) { current = current->next; ++currentIndex; }
+        while (currentIndex > index) { current = current->prev; --currentIndex; }
+
+        finger = current;
+        fingerIndex = index;
+        return current;
+    }
+
+    void resetFinger() const {
+        finger = nullptr;
+        fingerIndex = 0;
+    }
+
+    void linkBack(Node* newNode) {
+        if (!head) {
+            head = tail = newNode;
+        } else {
+            tail->next = newNode;
+            newNode->prev = tail;
+            tail = newNode;
+        }
+        size++;
+    }
+
+    // Unlink and free a node, keeping the finger valid
+    Node* unlink(Node* node, int index) {
+        Node* following = node->next;
+
+        if (node->prev) node->prev->next = node->next;
+        else head = node->next;
+
+        if (node->next) node->next->prev = node->prev;
+        else tail = node->prev;
+
+        if (finger == node) {
+            // Park the finger on the successor, which now holds this index
+            finger = following;
+            if (!finger) resetFinger();
+        } else if (finger && index >= 0 && index < fingerIndex) {
+            --fingerIndex;
+        } else if (index < 0) {
+            resetFinger();
+        }
+
+        pool.destroy(node);
+        size--;
+        return following;
+    }
+
 public:
-    DoublyLinkedList() : head(nullptr), tail(nullptr), size(0) {}
-    
+    // Bidirectional iterator; IsConst selects the const_iterator flavour
+    template <bool IsConst>
+    class BasicIterator {
+    private:
+        friend class DoublyLinkedList;
+        using ListPtr = typename std::conditional<IsConst, const DoublyLinkedList*, DoublyLinkedList*>::type;
+
+        Node* current;
+        ListPtr owner;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+        using reference = typename std::conditional<IsConst, const T&, T&>::type;
+
+        BasicIterator(Node* node = nullptr, ListPtr list = nullptr) : current(node), owner(list) {}
+
+        // Allow iterator -> const_iterator conversion
+        template <bool OtherConst, typename = typename std::enable_if<IsConst && !OtherConst>::type>
+        BasicIterator(const BasicIterator<OtherConst>& other) : current(other.current), owner(other.owner) {}
+
+        reference operator*() const { return current->data; }
+        pointer operator->() const { return &current->data; }
+
+        BasicIterator& operator++() { current = current->next; return *this; }
+        BasicIterator operator++(int) { BasicIterator copy = *this; ++(*this); return copy; }
+
+        // Decrementing end() lands on the tail, as with std::list
+        BasicIterator& operator--() {
+            current = current ? current->prev : owner->tail;
+            return *this;
+        }
+        BasicIterator operator--(int) { BasicIterator copy = *this; --(*this); return copy; }
+
+        bool operator==(const BasicIterator& other) const { return current == other.current; }
+        bool operator!=(const BasicIterator& other) const { return current != other.current; }
+
+        template <bool> friend class BasicIterator;
+    };
+
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+    using reverse_iterator = std::reverse_iterator<Iterator>;
+    using const_reverse_iterator = std::reverse_iterator<ConstIterator>;
+
+    DoublyLinkedList() : head(nullptr), tail(nullptr), size(0), finger(nullptr), fingerIndex(0) {}
+
     // Copy constructor
-    DoublyLinkedList(const DoublyLinkedList& other) : head(nullptr), tail(nullptr), size(0) {
+    DoublyLinkedList(const DoublyLinkedList& other)
+        : head(nullptr), tail(nullptr), size(0), finger(nullptr), fingerIndex(0) {
         Node* current = other.head;
         while (current) {
             append(current->data);
             current = current->next;
         }
     }
-    
+
     // Assignment operator
     DoublyLinkedList& operator=(const DoublyLinkedList& other) {
         if (this != &other) {
@@ -43,25 +178,47 @@ public:
         }
         return *this;
     }
-    
+
+    // Move constructor: takes over the nodes and their chunks
+    DoublyLinkedList(DoublyLinkedList&& other) noexcept
+        : pool(std::move(other.pool)), head(other.head), tail(other.tail), size(other.size),
+          finger(other.finger), fingerIndex(other.fingerIndex) {
+        other.head = other.tail = nullptr;
+        other.size = 0;
+        other.resetFinger();
+    }
+
+    // Move assignment
+    DoublyLinkedList& operator=(DoublyLinkedList&& other) noexcept {
+        if (this != &other) {
+            clear();
+            pool = std::move(other.pool);
+            head = other.head;
+            tail = other.tail;
+            size = other.size;
+            finger = other.finger;
+            fingerIndex = other.fingerIndex;
+            other.head = other.tail = nullptr;
+            other.size = 0;
+            other.resetFinger();
+        }
+        return *this;
+    }
+
     ~DoublyLinkedList() {
         clear();
     }
 
     void append(const T& value) {
-        Node* newNode = new Node(value);
-        if (!head) {
-            head = tail = newNode;
-        } else {
-            tail->next = newNode;
-            newNode->prev = tail;
-            tail = newNode;
-        }
-        size++;
+        linkBack(pool.create(value));
+    }
+
+    void append(T&& value) {
+        linkBack(pool.create(std::move(value)));
     }
 
     void prepend(const T& value) {
-        Node* newNode = new Node(value);
+        Node* newNode = pool.create(value);
         if (!head) {
             head = tail = newNode;
         } else {
@@ -70,52 +227,64 @@ public:
             head = newNode;
         }
         size++;
+        if (finger) fingerIndex++;
     }
 
     void removeAt(int index) {
         if (index < 0 || index >= size) return;
+        unlink(nodeAt(index), index);
+    }
 
-        Node* current = head;
-        for (int i = 0; i < index; ++i) current = current->next;
-
-        if (current->prev) current->prev->next = current->next;
-        else head = current->next;
-
-        if (current->next) current->next->prev = current->prev;
-        else tail = current->prev;
-
-        delete current;
-        size--;
+    // Remove the element an iterator points at in O(1); returns the next position
+    Iterator erase(Iterator position) {
+        if (!position.current) return end();
+        return Iterator(unlink(position.current, -1), this);
     }
 
     T* get(int index) const {
         if (index < 0 || index >= size) return nullptr;
-
-        Node* current = head;
-        for (int i = 0; i < index; ++i) current = current->next;
-
-        return &current->data;
+        return &nodeAt(index)->data;
     }
 
     int getSize() const {
         return size;
     }
 
+    // Node allocator, for its chunk / byte counters
+    const NodeAlloc<Node>& getAllocator() const {
+        return pool;
+    }
+
+    bool isEmpty() const {
+        return size == 0;
+    }
+
+    // With a bulk-releasing allocator the nodes are only destroyed (skipped
+    // entirely for trivial T) and every chunk is handed back at once.
     void clear() {
-        while (head) {
-            Node* tmp = head;
-            head = head->next;
-            delete tmp;
+        if (NodeAlloc<Node>::releasesInBulk) {
+            if (!std::is_trivially_destructible<T>::value) {
+                for (Node* current = head; current; current = current->next) {
+                    current->~Node();
+                }
+            }
+            pool.release();
+        } else {
+            while (head) {
+                Node* tmp = head;
+                head = head->next;
+                pool.destroy(tmp);
+            }
         }
+        head = nullptr;
         tail = nullptr;
         size = 0;
+        resetFinger();
     }
 
     void display() const {
-        Node* current = head;
-        while (current) {
-            std::cout << current->data.name << " (ID: " << current->data.id << ")\n";
-            current = current->next;
+        for (const T& item : *this) {
+            std::cout << item.name << " (ID: " << item.id << ")\n";
         }
     }
 
@@ -130,20 +299,18 @@ public:
         return nullptr;
     }
 
-
     // Iteration support
-    class Iterator {
-    private:
-        Node* current;
-    public:
-        Iterator(Node* node) : current(node) {}
-        T& operator*() { return current->data; }
-        Iterator& operator++() { current = current->next; return *this; }
-        bool operator!=(const Iterator& other) const { return current != other.current; }
-    };
+    Iterator begin() { return Iterator(head, this); }
+    Iterator end() { return Iterator(nullptr, this); }
+    ConstIterator begin() const { return ConstIterator(head, this); }
+    ConstIterator end() const { return ConstIterator(nullptr, this); }
+    ConstIterator cbegin() const { return begin(); }
+    ConstIterator cend() const { return end(); }
 
-    Iterator begin() { return Iterator(head); }
-    Iterator end() { return Iterator(nullptr); }
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
 };
 
 #endif
@@ -2,84 +2,177 @@
 #define DYNAMIC_ARRAY_HPP
 
 #include <iostream>
+#include <new>
+#include <stdexcept>
+#include <utility>
 
+// Growable array backed by raw (uninitialised) storage.
+// Only the first `size` slots hold constructed objects; growth moves the
+// existing elements into the new block (or copies them if T's move
+// constructor may throw) instead of default-constructing and assigning.
 template <typename T>
 class DynamicArray {
 private:
+    static const int DEFAULT_CAPACITY = 10;
+
     T* data;
     int capacity;
     int size;
-    
-    void resize() {
-        int newCapacity = capacity * 2;
-        T* newData = new T[newCapacity];
-        
-        for (int i = 0; i < size; ++i) {
-            newData[i] = data[i];
+
+    static T* allocate(int count) {
+        return count > 0 ? static_cast<T*>(::operator new(sizeof(T) * count)) : nullptr;
+    }
+
+    static void deallocate(T* block) noexcept {
+        ::operator delete(block);
+    }
+
+    void destroyRange(int from, int to) noexcept {
+        for (int i = from; i < to; ++i) {
+            data[i].~T();
         }
-        
-        delete[] data;
+    }
+
+    // Move (or copy, when moving could throw) the elements into a block of newCapacity
+    void reallocate(int newCapacity) {
+        T* newData = allocate(newCapacity);
+        int constructed = 0;
+        try {
+            for (; constructed < size; ++constructed) {
+                ::new (static_cast<void*>(newData + constructed)) T(std::move_if_noexcept(data[constructed]));
+            }
+        } catch (...) {
+            for (int i = 0; i < constructed; ++i) {
+                newData[i].~T();
+            }
+            deallocate(newData);
+            throw;
+        }
+
+        destroyRange(0, size);
+        deallocate(data);
         data = newData;
         capacity = newCapacity;
     }
 
+    void resize() {
+        reallocate(capacity > 0 ? capacity * 2 : DEFAULT_CAPACITY);
+    }
+
+    void copyFrom(const DynamicArray& other) {
+        data = allocate(other.capacity);
+        capacity = other.capacity;
+        size = 0;
+        try {
+            for (; size < other.size; ++size) {
+                ::new (static_cast<void*>(data + size)) T(other.data[size]);
+            }
+        } catch (...) {
+            destroyRange(0, size);
+            deallocate(data);
+            data = nullptr;
+            capacity = size = 0;
+            throw;
+        }
+    }
+
 public:
     // Default constructor
-    DynamicArray() : data(nullptr), capacity(0), size(0) {
-        capacity = 10; // Initial capacity
-        data = new T[capacity];
-    }
-    
+    DynamicArray() : data(allocate(DEFAULT_CAPACITY)), capacity(DEFAULT_CAPACITY), size(0) {}
+
     // Constructor with initial capacity
-    explicit DynamicArray(int initialCapacity) : data(nullptr), capacity(initialCapacity), size(0) {
-        if (initialCapacity <= 0) initialCapacity = 10;
-        data = new T[capacity];
+    explicit DynamicArray(int initialCapacity) : data(nullptr), capacity(0), size(0) {
+        if (initialCapacity <= 0) initialCapacity = DEFAULT_CAPACITY;
+        data = allocate(initialCapacity);
+        capacity = initialCapacity;
     }
-    
+
     // Copy constructor
-    DynamicArray(const DynamicArray& other) : data(nullptr), capacity(other.capacity), size(other.size) {
-        data = new T[capacity];
-        for (int i = 0; i < size; ++i) {
-            data[i] = other.data[i];
-        }
+    DynamicArray(const DynamicArray& other) : data(nullptr), capacity(0), size(0) {
+        copyFrom(other);
+    }
+
+    // Move constructor: steals the buffer, leaving other empty
+    DynamicArray(DynamicArray&& other) noexcept : data(other.data), capacity(other.capacity), size(other.size) {
+        other.data = nullptr;
+        other.capacity = 0;
+        other.size = 0;
     }
-    
+
     // Assignment operator
     DynamicArray& operator=(const DynamicArray& other) {
         if (this != &other) {
-            delete[] data;
-            
+            DynamicArray copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    // Move assignment
+    DynamicArray& operator=(DynamicArray&& other) noexcept {
+        if (this != &other) {
+            destroyRange(0, size);
+            deallocate(data);
+            data = other.data;
             capacity = other.capacity;
             size = other.size;
-            data = new T[capacity];
-            
-            for (int i = 0; i < size; ++i) {
-                data[i] = other.data[i];
-            }
+            other.data = nullptr;
+            other.capacity = 0;
+            other.size = 0;
         }
         return *this;
     }
-    
+
     // Destructor
     ~DynamicArray() {
-        delete[] data;
+        destroyRange(0, size);
+        deallocate(data);
     }
-    
+
+    void swap(DynamicArray& other) noexcept {
+        std::swap(data, other.data);
+        std::swap(capacity, other.capacity);
+        std::swap(size, other.size);
+    }
+
     // Add element to the end
     void push_back(const T& item) {
         if (size >= capacity) {
+            // item may live in this array, so copy it before the buffer moves
+            T copy(item);
+            resize();
+            ::new (static_cast<void*>(data + size)) T(std::move(copy));
+        } else {
+            ::new (static_cast<void*>(data + size)) T(item);
+        }
+        ++size;
+    }
+
+    void push_back(T&& item) {
+        emplace_back(std::move(item));
+    }
+
+    // Construct an element in place at the end
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (size >= capacity) {
+            T value(std::forward<Args>(args)...);
             resize();
+            ::new (static_cast<void*>(data + size)) T(std::move(value));
+        } else {
+            ::new (static_cast<void*>(data + size)) T(std::forward<Args>(args)...);
         }
-        data[size++] = item;
+        return data[size++];
     }
-    
+
     // Remove last element
     void pop_back() {
         if (size > 0) {
             --size;
+            data[size].~T();
         }
     }
-    
+
     // Access element by index
     T& operator[](int index) {
         if (index < 0 || index >= size) {
@@ -87,7 +180,7 @@ public:
         }
         return data[index];
     }
-    
+
     // Access element by index (const version)
     const T& operator[](int index) const {
         if (index < 0 || index >= size) {
@@ -95,7 +188,7 @@ public:
         }
         return data[index];
     }
-    
+
     // Get element at index with bounds checking
     T& at(int index) {
         if (index < 0 || index >= size) {
@@ -103,7 +196,7 @@ public:
         }
         return data[index];
     }
-    
+
     // Get element at index with bounds checking (const version)
     const T& at(int index) const {
         if (index < 0 || index >= size) {
@@ -111,22 +204,23 @@ public:
         }
         return data[index];
     }
-    
+
     // Get current size
-    int getSize() const {
+    int getSize() const noexcept {
         return size;
     }
-    
+
     // Check if empty
-    bool empty() const {
+    bool empty() const noexcept {
         return size == 0;
     }
-    
-    // Clear all elements
-    void clear() {
+
+    // Clear all elements (capacity is kept)
+    void clear() noexcept {
+        destroyRange(0, size);
         size = 0;
     }
-    
+
     // Get first element
     T& front() {
         if (size == 0) {
@@ -134,7 +228,7 @@ public:
         }
         return data[0];
     }
-    
+
     // Get first element (const version)
     const T& front() const {
         if (size == 0) {
@@ -142,7 +236,7 @@ public:
         }
         return data[0];
     }
-    
+
     // Get last element
     T& back() {
         if (size == 0) {
@@ -150,7 +244,7 @@ public:
         }
         return data[size - 1];
     }
-    
+
     // Get last element (const version)
     const T& back() const {
         if (size == 0) {
@@ -158,40 +252,52 @@ public:
         }
         return data[size - 1];
     }
-    
+
     // Insert element at specific position
     void insert(int index, const T& item) {
         if (index < 0 || index > size) {
             throw std::out_of_range("Index out of range");
         }
-        
+        insert(index, T(item));
+    }
+
+    void insert(int index, T&& item) {
+        if (index < 0 || index > size) {
+            throw std::out_of_range("Index out of range");
+        }
+        if (index == size) {
+            emplace_back(std::move(item));
+            return;
+        }
         if (size >= capacity) {
             resize();
         }
-        
-        // Shift elements to the right
-        for (int i = size; i > index; --i) {
-            data[i] = data[i - 1];
-        }
-        
-        data[index] = item;
+
+        // Shift elements to the right: move-construct the new last slot,
+        // then move-assign the rest down
+        ::new (static_cast<void*>(data + size)) T(std::move(data[size - 1]));
         ++size;
+        for (int i = size - 2; i > index; --i) {
+            data[i] = std::move(data[i - 1]);
+        }
+
+        data[index] = std::move(item);
     }
-    
+
     // Remove element at specific position
     void erase(int index) {
         if (index < 0 || index >= size) {
             throw std::out_of_range("Index out of range");
         }
-        
+
         // Shift elements to the left
         for (int i = index; i < size - 1; ++i) {
-            data[i] = data[i + 1];
+            data[i] = std::move(data[i + 1]);
         }
-        
-        --size;
+
+        pop_back();
     }
-    
+
     // Find element and return index (-1 if not found)
     int find(const T& item) const {
         for (int i = 0; i < size; ++i) {
@@ -201,40 +307,59 @@ public:
         }
         return -1;
     }
-    
+
     // Append all elements from another DynamicArray
     void append(const DynamicArray& other) {
+        if (this == &other) {
+            DynamicArray copy(other);
+            append(std::move(copy));
+            return;
+        }
+        reserve(size + other.size);
         for (int i = 0; i < other.getSize(); ++i) {
             push_back(other[i]);
         }
     }
-    
+
+    // Append by moving the elements out of other
+    void append(DynamicArray&& other) {
+        if (this == &other) {
+            // Nothing to move from; duplicate the elements like append(const&)
+            append(static_cast<const DynamicArray&>(other));
+            return;
+        }
+        reserve(size + other.size);
+        for (int i = 0; i < other.getSize(); ++i) {
+            push_back(std::move(other.data[i]));
+        }
+        other.clear();
+    }
+
     // Get capacity
-    int getCapacity() const {
+    int getCapacity() const noexcept {
         return capacity;
     }
-    
+
     // Reserve capacity
     void reserve(int newCapacity) {
         if (newCapacity > capacity) {
-            T* newData = new T[newCapacity];
-            
-            for (int i = 0; i < size; ++i) {
-                newData[i] = data[i];
-            }
-            
-            delete[] data;
-            data = newData;
-            capacity = newCapacity;
+            reallocate(newCapacity);
         }
     }
-    
+
+    // Release unused capacity
+    void shrink_to_fit() {
+        if (capacity > size) {
+            reallocate(size);
+        }
+    }
+
     // Iterator-like functionality
-    T* begin() { return data; }
-    T* end() { return data + size; }
-    const T* begin() const { return data; }
-    const T* end() const { return data + size; }
-    
+    T* begin() noexcept { return data; }
+    T* end() noexcept { return data + size; }
+    const T* begin() const noexcept { return data; }
+    const T* end() const noexcept { return data + size; }
+
     // Display contents (for debugging)
     void display() const {
         std::cout << "DynamicArray [size=" << size << ", capacity=" << capacity << "]: ";
@@ -0,0 +1,322 @@
+#ifndef HASH_MAP_HPP
+#define HASH_MAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <string>
+#include <string_view>
+#include <utility>
+
+// Default hasher. The std::string version hashes through std::string_view so
+// that lookups can be made with a string_view (or a const char*) without
+// building a temporary std::string.
+template <typename K>
+struct HashMapHash {
+    std::size_t operator()(const K& key) const {
+        return std::hash<K>()(key);
+    }
+};
+
+template <>
+struct HashMapHash<std::string> {
+    std::size_t operator()(std::string_view key) const {
+        return std::hash<std::string_view>()(key);
+    }
+};
+
+// Open-addressing hash map using Robin Hood linear probing.
+// Keys and values live inline in one flat slot array next to a parallel byte
+// array of probe distances (0 = empty), so a lookup touches one or two cache
+// lines. Capacity is a power of two and the table grows at 80% load; erase
+// uses backward shifting, so there are no tombstones.
+//
+// find / contains / erase accept any key type the hasher and == understand,
+// e.g. std::string_view for a HashMap<std::string, V>.
+template <typename K, typename V, typename Hash = HashMapHash<K>>
+class HashMap {
+private:
+    struct Slot {
+        K key;
+        V value;
+    };
+
+    static const int MIN_CAPACITY = 16;
+    static const std::uint8_t MAX_DISTANCE = 255;
+
+    Slot* slots;
+    std::uint8_t* distances;  // Probe distance + 1; 0 marks an empty slot
+    int capacity;
+    int size;
+    Hash hasher;
+
+    // Spread the hash bits so identity hashes (e.g. small ints) probe well
+    template <typename Q>
+    std::size_t homeOf(const Q& key) const {
+        std::uint64_t h = static_cast<std::uint64_t>(hasher(key));
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        return static_cast<std::size_t>(h) & static_cast<std::size_t>(capacity - 1);
+    }
+
+    void allocate(int newCapacity) {
+        slots = static_cast<Slot*>(::operator new(sizeof(Slot) * newCapacity));
+        distances = new std::uint8_t[newCapacity]();
+        capacity = newCapacity;
+    }
+
+    void destroyAll() {
+        for (int i = 0; i < capacity; ++i) {
+            if (distances[i]) slots[i].~Slot();
+        }
+        ::operator delete(slots);
+        delete[] distances;
+        slots = nullptr;
+        distances = nullptr;
+        capacity = 0;
+        size = 0;
+    }
+
+    template <typename Q>
+    int indexOf(const Q& key) const {
+        if (size == 0) return -1;
+        int mask = capacity - 1;
+        int index = static_cast<int>(homeOf(key));
+        for (int distance = 1; ; ++distance) {
+            // Robin Hood invariant: once we pass a slot closer to its home
+            // than we are to ours, the key cannot be further along
+            if (distances[index] < distance) return -1;
+            if (distances[index] == distance && slots[index].key == key) return index;
+            index = (index + 1) & mask;
+        }
+    }
+
+    // Place a new entry, which must not already be present; returns its slot
+    int insertNew(K&& key, V&& value) {
+        if (size + 1 > capacity - capacity / 5) {
+            rehash(capacity * 2);
+        }
+
+        Slot carry{std::move(key), std::move(value)};
+        int mask = capacity - 1;
+        int index = static_cast<int>(homeOf(carry.key));
+        int distance = 1;
+        int placedAt = -1;
+
+        while (true) {
+            if (distances[index] == 0) {
+                ::new (static_cast<void*>(&slots[index])) Slot(std::move(carry));
+                distances[index] = static_cast<std::uint8_t>(distance);
+                size++;
+                return placedAt == -1 ? index : placedAt;
+            }
+            if (distances[index] < distance) {
+                // Steal from the richer entry and keep inserting it instead
+                std::swap(carry, slots[index]);
+                std::uint8_t displaced = distances[index];
+                distances[index] = static_cast<std::uint8_t>(distance);
+                distance = displaced;
+                if (placedAt == -1) placedAt = index;
+            }
+            index = (index + 1) & mask;
+            distance++;
+            if (distance >= MAX_DISTANCE) {
+                // Pathological clustering: put the carried entry back via a
+                // bigger table (the placed one is re-found afterwards)
+                K pendingKey = std::move(carry.key);
+                V pendingValue = std::move(carry.value);
+                rehash(capacity * 2);
+                insertNew(std::move(pendingKey), std::move(pendingValue));
+                return -1;
+            }
+        }
+    }
+
+    void rehash(int newCapacity) {
+        Slot* oldSlots = slots;
+        std::uint8_t* oldDistances = distances;
+        int oldCapacity = capacity;
+
+        allocate(newCapacity);
+        size = 0;
+        for (int i = 0; i < oldCapacity; ++i) {
+            if (oldDistances[i]) {
+                insertNew(std::move(oldSlots[i].key), std::move(oldSlots[i].value));
+                oldSlots[i].~Slot();
+            }
+        }
+        ::operator delete(oldSlots);
+        delete[] oldDistances;
+    }
+
+    void removeAt(int index) {
+        int mask = capacity - 1;
+        slots[index].~Slot();
+        distances[index] = 0;
+
+        // Backward shift: pull following displaced entries one step home
+        int next = (index + 1) & mask;
+        while (distances[next] > 1) {
+            ::new (static_cast<void*>(&slots[index])) Slot(std::move(slots[next]));
+            slots[next].~Slot();
+            distances[index] = static_cast<std::uint8_t>(distances[next] - 1);
+            distances[next] = 0;
+            index = next;
+            next = (next + 1) & mask;
+        }
+        size--;
+    }
+
+public:
+    HashMap() : slots(nullptr), distances(nullptr), capacity(0), size(0) {
+        allocate(MIN_CAPACITY);
+    }
+
+    explicit HashMap(int expectedSize) : slots(nullptr), distances(nullptr), capacity(0), size(0) {
+        allocate(MIN_CAPACITY);
+        reserve(expectedSize);
+    }
+
+    HashMap(const HashMap& other) : slots(nullptr), distances(nullptr), capacity(0), size(0), hasher(other.hasher) {
+        allocate(other.capacity > 0 ? other.capacity : MIN_CAPACITY);
+        for (int i = 0; i < other.capacity; ++i) {
+            if (other.distances[i]) {
+                ::new (static_cast<void*>(&slots[i])) Slot(other.slots[i]);
+                distances[i] = other.distances[i];
+            }
+        }
+        size = other.size;
+    }
+
+    HashMap(HashMap&& other) noexcept
+        : slots(other.slots), distances(other.distances), capacity(other.capacity), size(other.size),
+          hasher(std::move(other.hasher)) {
+        other.slots = nullptr;
+        other.distances = nullptr;
+        other.capacity = 0;
+        other.size = 0;
+    }
+
+    HashMap& operator=(const HashMap& other) {
+        if (this != &other) {
+            HashMap copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    HashMap& operator=(HashMap&& other) noexcept {
+        if (this != &other) {
+            if (slots) destroyAll();
+            swap(other);
+        }
+        return *this;
+    }
+
+    ~HashMap() {
+        if (slots) destroyAll();
+    }
+
+    void swap(HashMap& other) noexcept {
+        std::swap(slots, other.slots);
+        std::swap(distances, other.distances);
+        std::swap(capacity, other.capacity);
+        std::swap(size, other.size);
+        std::swap(hasher, other.hasher);
+    }
+
+    // Insert or overwrite; returns true if the key was new
+    bool insert(const K& key, const V& value) {
+        return insert(K(key), V(value));
+    }
+
+    bool insert(K&& key, V&& value) {
+        if (capacity == 0) allocate(MIN_CAPACITY);
+        int index = indexOf(key);
+        if (index != -1) {
+            slots[index].value = std::move(value);
+            return false;
+        }
+        insertNew(std::move(key), std::move(value));
+        return true;
+    }
+
+    // Value for key, default-constructed and inserted if missing
+    V& operator[](const K& key) {
+        if (capacity == 0) allocate(MIN_CAPACITY);
+        int index = indexOf(key);
+        if (index == -1) {
+            index = insertNew(K(key), V());
+            if (index == -1) index = indexOf(key);
+        }
+        return slots[index].value;
+    }
+
+    template <typename Q>
+    V* find(const Q& key) {
+        int index = indexOf(key);
+        return index == -1 ? nullptr : &slots[index].value;
+    }
+
+    template <typename Q>
+    const V* find(const Q& key) const {
+        int index = indexOf(key);
+        return index == -1 ? nullptr : &slots[index].value;
+    }
+
+    template <typename Q>
+    bool contains(const Q& key) const {
+        return indexOf(key) != -1;
+    }
+
+    // Remove key; returns true if it was present
+    template <typename Q>
+    bool erase(const Q& key) {
+        int index = indexOf(key);
+        if (index == -1) return false;
+        removeAt(index);
+        return true;
+    }
+
+    // Make room for expectedSize entries without further rehashing
+    void reserve(int expectedSize) {
+        int needed = MIN_CAPACITY;
+        while (needed - needed / 5 < expectedSize) needed *= 2;
+        if (needed > capacity) {
+            if (capacity == 0) allocate(needed);
+            else rehash(needed);
+        }
+    }
+
+    void clear() {
+        for (int i = 0; i < capacity; ++i) {
+            if (distances[i]) {
+                slots[i].~Slot();
+                distances[i] = 0;
+            }
+        }
+        size = 0;
+    }
+
+    int getSize() const { return size; }
+    bool isEmpty() const { return size == 0; }
+
+    // Visit every entry (in table order) as fn(const K&, V&)
+    template <typename Fn>
+    void forEach(Fn fn) {
+        for (int i = 0; i < capacity; ++i) {
+            if (distances[i]) fn(static_cast<const K&>(slots[i].key), slots[i].value);
+        }
+    }
+
+    template <typename Fn>
+    void forEach(Fn fn) const {
+        for (int i = 0; i < capacity; ++i) {
+            if (distances[i]) fn(slots[i].key, static_cast<const V&>(slots[i].value));
+        }
+    }
+};
+
+#endif
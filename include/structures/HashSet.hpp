@@ -0,0 +1,40 @@
+#ifndef HASH_SET_HPP
+#define HASH_SET_HPP
+
+#include "HashMap.hpp"
+
+// Set of keys on top of HashMap (the value slot is a single byte).
+// Like HashMap, contains / erase accept heterogeneous keys such as
+// std::string_view for a HashSet<std::string>.
+template <typename K, typename Hash = HashMapHash<K>>
+class HashSet {
+private:
+    HashMap<K, char, Hash> map;
+
+public:
+    HashSet() : map() {}
+    explicit HashSet(int expectedSize) : map(expectedSize) {}
+
+    // Returns true if the key was not already present
+    bool insert(const K& key) { return map.insert(key, 0); }
+    bool insert(K&& key) { return map.insert(std::move(key), 0); }
+
+    template <typename Q>
+    bool contains(const Q& key) const { return map.contains(key); }
+
+    template <typename Q>
+    bool erase(const Q& key) { return map.erase(key); }
+
+    void reserve(int expectedSize) { map.reserve(expectedSize); }
+    void clear() { map.clear(); }
+
+    int getSize() const { return map.getSize(); }
+    bool isEmpty() const { return map.isEmpty(); }
+
+    template <typename Fn>
+    void forEach(Fn fn) const {
+        map.forEach([&fn](const K& key, const char&) { fn(key); });
+    }
+};
+
+#endif
@@ -0,0 +1,191 @@
+#ifndef MPMC_RING_QUEUE_HPP
+#define MPMC_RING_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include "DynamicArray.hpp"
+
+// Bounded lock-free queue for any number of producer and consumer threads
+// (Vyukov's array queue), e.g. several check-in kiosks feeding one manager.
+//
+// Every cell carries a sequence number that says whose turn it is: a
+// producer may fill cell i when seq == position, a consumer may empty it when
+// seq == position + 1. Producers and consumers each claim positions with a
+// CAS on their own cache-line-padded counter, so the two sides never write
+// the same line except for the cell itself.
+//
+// Exposes the CircularQueue interface (enqueue / dequeue / peek throw when
+// full / empty) plus tryEnqueue / tryDequeue, a spinning enqueueBlocking and
+// dequeueBatch. peek and clear inspect the front without claiming it, so
+// they are only meaningful while no other thread is dequeuing. isEmpty /
+// isFull / size are snapshots.
+template <typename T>
+class MpmcRingQueue {
+private:
+    static const std::size_t CACHE_LINE = 64;
+
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* item() { return reinterpret_cast<T*>(storage); }
+        const T* item() const { return reinterpret_cast<const T*>(storage); }
+    };
+
+    struct alignas(CACHE_LINE) Position {
+        std::atomic<std::size_t> value;
+    };
+
+    Cell* cells;
+    std::size_t capacity;  // Power of two
+    std::size_t mask;
+    Position enqueuePos;
+    Position dequeuePos;
+
+    static std::size_t roundUp(int requested) {
+        std::size_t size = 2;
+        while (size < static_cast<std::size_t>(requested > 0 ? requested : 1)) size *= 2;
+        return size;
+    }
+
+    template <typename U>
+    bool tryPush(U&& item) {
+        std::size_t pos = enqueuePos.value.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = cells[pos & mask];
+            std::size_t seq = cell.sequence.load(std::memory_order_acquire);
+            std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (enqueuePos.value.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    ::new (static_cast<void*>(cell.storage)) T(std::forward<U>(item));
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+                // pos was reloaded by the failed CAS
+            } else if (diff < 0) {
+                return false;  // Cell still holds an item from one lap ago: full
+            } else {
+                pos = enqueuePos.value.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+public:
+    // Capacity is rounded up to a power of two (default 100 -> 128)
+    explicit MpmcRingQueue(int size = 100)
+        : cells(static_cast<Cell*>(::operator new(sizeof(Cell) * roundUp(size)))),
+          capacity(roundUp(size)), mask(capacity - 1) {
+        for (std::size_t i = 0; i < capacity; ++i) {
+            ::new (static_cast<void*>(&cells[i].sequence)) std::atomic<std::size_t>(i);
+        }
+        enqueuePos.value.store(0, std::memory_order_relaxed);
+        dequeuePos.value.store(0, std::memory_order_relaxed);
+    }
+
+    MpmcRingQueue(const MpmcRingQueue&) = delete;
+    MpmcRingQueue& operator=(const MpmcRingQueue&) = delete;
+
+    ~MpmcRingQueue() {
+        clear();
+        for (std::size_t i = 0; i < capacity; ++i) {
+            cells[i].sequence.~atomic();
+        }
+        ::operator delete(cells);
+    }
+
+    bool tryEnqueue(const T& item) { return tryPush(item); }
+    bool tryEnqueue(T&& item) { return tryPush(std::move(item)); }
+
+    // Wait (spinning, then yielding) until there is room
+    void enqueueBlocking(const T& item) {
+        T copy(item);
+        enqueueBlocking(std::move(copy));
+    }
+
+    void enqueueBlocking(T&& item) {
+        for (int spins = 0; !tryPush(std::move(item)); ++spins) {
+            if (spins > 64) std::this_thread::yield();
+        }
+    }
+
+    void enqueue(const T& item) {
+        if (!tryPush(item)) {
+            throw std::overflow_error("MpmcRingQueue::enqueue: queue is full");
+        }
+    }
+
+    bool tryDequeue(T& out) {
+        std::size_t pos = dequeuePos.value.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = cells[pos & mask];
+            std::size_t seq = cell.sequence.load(std::memory_order_acquire);
+            std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeuePos.value.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    T* item = cell.item();
+                    out = std::move(*item);
+                    item->~T();
+                    // Hand the cell to the producer one lap ahead
+                    cell.sequence.store(pos + capacity, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // Nothing published at this position yet: empty
+            } else {
+                pos = dequeuePos.value.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    T dequeue() {
+        T item;
+        if (!tryDequeue(item)) {
+            throw std::underflow_error("MpmcRingQueue::dequeue: queue is empty");
+        }
+        return item;
+    }
+
+    // Move up to maxItems (all available if maxItems <= 0) into out;
+    // returns how many were taken. Other consumers may interleave.
+    int dequeueBatch(DynamicArray<T>& out, int maxItems = 0) {
+        int taken = 0;
+        T item;
+        while ((maxItems <= 0 || taken < maxItems) && tryDequeue(item)) {
+            out.push_back(std::move(item));
+            taken++;
+        }
+        return taken;
+    }
+
+    T peek() const {
+        std::size_t pos = dequeuePos.value.load(std::memory_order_relaxed);
+        const Cell& cell = cells[pos & mask];
+        if (cell.sequence.load(std::memory_order_acquire) != pos + 1) {
+            throw std::underflow_error("MpmcRingQueue::peek: queue is empty");
+        }
+        return *cell.item();
+    }
+
+    // Drop everything currently queued
+    void clear() {
+        T discarded;
+        while (tryDequeue(discarded)) {}
+    }
+
+    bool isEmpty() const { return size() == 0; }
+    bool isFull() const { return size() >= static_cast<int>(capacity); }
+
+    int size() const {
+        std::size_t head = dequeuePos.value.load(std::memory_order_acquire);
+        std::size_t tail = enqueuePos.value.load(std::memory_order_acquire);
+        return tail > head ? static_cast<int>(tail - head) : 0;
+    }
+
+    int getCapacity() const { return static_cast<int>(capacity); }
+};
+
+#endif
@@ -0,0 +1,198 @@
+#ifndef NODE_POOL_HPP
+#define NODE_POOL_HPP
+
+#include <cstddef>
+#include <new>
+#include <utility>
+
+// Slab allocator for linked-structure nodes.
+// Nodes are carved out of contiguous chunks (16, 32, 64 ... up to 1024 slots)
+// so that a list built in one go sits together in memory, and a whole list can
+// be released in O(chunks). Freed slots go on an intrusive free list and are
+// reused before a new chunk is requested.
+//
+// The pool does not track which slots are live, and release() runs no
+// destructors: the owner must destroy() (or at least destruct) every object it
+// created before calling release() or letting the pool go out of scope.
+template <typename T>
+class NodePool {
+private:
+    union Slot {
+        Slot* nextFree;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    struct Chunk {
+        Chunk* next;
+        int capacity;
+        Slot* slots;
+    };
+
+    static const int FIRST_CHUNK_SLOTS = 16;
+    static const int MAX_CHUNK_SLOTS = 1024;
+
+    Chunk* chunks;       // Most recently allocated chunk first
+    Slot* freeList;
+    int bumpIndex;       // Next never-used slot in chunks->slots
+    int chunkCount;
+    int liveCount;
+    std::size_t bytesReserved;
+
+    void addChunk() {
+        int capacity = chunks ? chunks->capacity * 2 : FIRST_CHUNK_SLOTS;
+        if (capacity > MAX_CHUNK_SLOTS) capacity = MAX_CHUNK_SLOTS;
+
+        Chunk* chunk = new Chunk;
+        chunk->slots = static_cast<Slot*>(::operator new(sizeof(Slot) * capacity));
+        chunk->capacity = capacity;
+        chunk->next = chunks;
+        chunks = chunk;
+        bumpIndex = 0;
+        chunkCount++;
+        bytesReserved += sizeof(Slot) * capacity;
+    }
+
+    Slot* allocateSlot() {
+        if (freeList) {
+            Slot* slot = freeList;
+            freeList = slot->nextFree;
+            return slot;
+        }
+        if (!chunks || bumpIndex == chunks->capacity) {
+            addChunk();
+        }
+        return &chunks->slots[bumpIndex++];
+    }
+
+public:
+    // release() frees every slot, live or not, without walking them
+    static const bool releasesInBulk = true;
+
+    NodePool() : chunks(nullptr), freeList(nullptr), bumpIndex(0),
+                 chunkCount(0), liveCount(0), bytesReserved(0) {}
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    // Moving hands over the chunks, so objects already created stay valid
+    NodePool(NodePool&& other) noexcept
+        : chunks(other.chunks), freeList(other.freeList), bumpIndex(other.bumpIndex),
+          chunkCount(other.chunkCount), liveCount(other.liveCount), bytesReserved(other.bytesReserved) {
+        other.chunks = nullptr;
+        other.freeList = nullptr;
+        other.bumpIndex = 0;
+        other.chunkCount = 0;
+        other.liveCount = 0;
+        other.bytesReserved = 0;
+    }
+
+    NodePool& operator=(NodePool&& other) noexcept {
+        if (this != &other) {
+            release();
+            std::swap(chunks, other.chunks);
+            std::swap(freeList, other.freeList);
+            std::swap(bumpIndex, other.bumpIndex);
+            std::swap(chunkCount, other.chunkCount);
+            std::swap(liveCount, other.liveCount);
+            std::swap(bytesReserved, other.bytesReserved);
+        }
+        return *this;
+    }
+
+    ~NodePool() {
+        release();
+    }
+
+    template <typename... Args>
+    T* create(Args&&... args) {
+        Slot* slot = allocateSlot();
+        T* object;
+        try {
+            object = ::new (static_cast<void*>(slot->storage)) T(std::forward<Args>(args)...);
+        } catch (...) {
+            slot->nextFree = freeList;
+            freeList = slot;
+            throw;
+        }
+        liveCount++;
+        return object;
+    }
+
+    void destroy(T* object) {
+        if (!object) return;
+        object->~T();
+        Slot* slot = reinterpret_cast<Slot*>(object);
+        slot->nextFree = freeList;
+        freeList = slot;
+        liveCount--;
+    }
+
+    // Return every chunk to the system in one pass
+    void release() {
+        while (chunks) {
+            Chunk* chunk = chunks;
+            chunks = chunks->next;
+            ::operator delete(chunk->slots);
+            delete chunk;
+        }
+        freeList = nullptr;
+        bumpIndex = 0;
+        chunkCount = 0;
+        liveCount = 0;
+        bytesReserved = 0;
+    }
+
+    // Statistics
+    int getChunkCount() const { return chunkCount; }
+    int getLiveCount() const { return liveCount; }
+    std::size_t getBytesInUse() const { return sizeof(Slot) * static_cast<std::size_t>(liveCount); }
+    std::size_t getBytesReserved() const { return bytesReserved; }
+};
+
+// Plain new/delete allocator with the same interface as NodePool, for cases
+// where nodes must outlive or be shared beyond a single container.
+template <typename T>
+class HeapNodeAllocator {
+private:
+    int liveCount;
+
+public:
+    // Each node is a separate allocation and must be destroy()ed individually
+    static const bool releasesInBulk = false;
+
+    HeapNodeAllocator() : liveCount(0) {}
+
+    HeapNodeAllocator(const HeapNodeAllocator&) = delete;
+    HeapNodeAllocator& operator=(const HeapNodeAllocator&) = delete;
+
+    HeapNodeAllocator(HeapNodeAllocator&& other) noexcept : liveCount(other.liveCount) {
+        other.liveCount = 0;
+    }
+
+    HeapNodeAllocator& operator=(HeapNodeAllocator&& other) noexcept {
+        std::swap(liveCount, other.liveCount);
+        return *this;
+    }
+
+    template <typename... Args>
+    T* create(Args&&... args) {
+        T* object = new T(std::forward<Args>(args)...);
+        liveCount++;
+        return object;
+    }
+
+    void destroy(T* object) {
+        if (!object) return;
+        delete object;
+        liveCount--;
+    }
+
+    void release() {}
+
+    int getChunkCount() const { return 0; }
+    int getLiveCount() const { return liveCount; }
+    std::size_t getBytesInUse() const { return sizeof(T) * static_cast<std::size_t>(liveCount); }
+    std::size_t getBytesReserved() const { return getBytesInUse(); }
+};
+
+#endif
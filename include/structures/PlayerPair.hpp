@@ -2,6 +2,7 @@
 #define PLAYER_PAIR_HPP
 
 #include "../dto/Player.hpp"
+#include <utility>
 
 struct PlayerPair {
     Player first;
@@ -13,17 +14,11 @@ struct PlayerPair {
     // Constructor with two players
     PlayerPair(const Player& p1, const Player& p2) : first(p1), second(p2) {}
     
-    // Copy constructor
-    PlayerPair(const PlayerPair& other) : first(other.first), second(other.second) {}
-    
-    // Assignment operator
-    PlayerPair& operator=(const PlayerPair& other) {
-        if (this != &other) {
-            first = other.first;
-            second = other.second;
-        }
-        return *this;
-    }
+    // Copy and move operations are the implicit member-wise ones
+    PlayerPair(const PlayerPair& other) = default;
+    PlayerPair(PlayerPair&& other) noexcept = default;
+    PlayerPair& operator=(const PlayerPair& other) = default;
+    PlayerPair& operator=(PlayerPair&& other) noexcept = default;
     
     // Equality operator
     bool operator==(const PlayerPair& other) const {
@@ -54,9 +49,7 @@ struct PlayerPair {
     
     // Swap the order of players
     void swap() {
-        Player temp = first;
-        first = second;
-        second = temp;
+        std::swap(first, second);
     }
 };
 
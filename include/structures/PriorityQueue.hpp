@@ -2,225 +2,410 @@
 #define PRIORITYQUEUE_HPP
 
 #include <iostream>
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include "DynamicArray.hpp"
+#include "HashMap.hpp"
+
+// Key extraction for indexed queues. KeyOf = void means "not indexed".
+template <typename T, typename KeyOf>
+struct PriorityQueueKeyTraits {
+    static const bool indexed = true;
+    using Key = typename std::decay<decltype(std::declval<const KeyOf&>()(std::declval<const T&>()))>::type;
+};
 
 template <typename T>
+struct PriorityQueueKeyTraits<T, void> {
+    static const bool indexed = false;
+    using Key = int;
+};
+
+// Max-priority queue stored by value as a 4-ary heap in one contiguous,
+// geometrically growing buffer. Entries with equal priority leave in the
+// order they arrived: every enqueue is stamped with a monotonic sequence
+// number that breaks ties.
+//
+// When KeyOf is given (a functor returning a key for an item), the queue is
+// addressable: it keeps a key -> heap slot map so entries can be found,
+// re-prioritised or removed by key in O(log n). Keys are unique; enqueueing
+// an item whose key is already queued updates that entry in place.
+template <typename T, typename KeyOf = void>
 class PriorityQueue {
+private:
+    using Traits = PriorityQueueKeyTraits<T, KeyOf>;
+
+public:
+    using Key = typename Traits::Key;
+
 private:
     struct Node {
         T data;
         int priority;
+        unsigned long long seq;  // Arrival order, for FIFO among equal priorities
     };
 
-    Node** heap;  // Changed to pointer-to-pointer for proper memory management
-    int capacity;
-    int size;
+    static const int ARITY = 4;
+
+    DynamicArray<Node> heap;
+    unsigned long long nextSeq;
+    HashMap<Key, int> slots;  // Key -> heap index (indexed queues only)
 
-    void swap(Node*& a, Node*& b);  // Updated signature for pointer swapping
+    static bool higher(const Node& a, const Node& b);
+    static Key keyOf(const T& item);
+    void place(int index, Node&& node);
     void heapifyUp(int index);
     void heapifyDown(int index);
+    void removeAt(int index);
+    void buildHeap();
+    int slotOf(const Key& key) const;
+    DynamicArray<const Node*> inDequeueOrder() const;
 
 public:
-    PriorityQueue(int capacity = 100);
-    ~PriorityQueue();
-    
-    // Copy constructor and assignment operator for proper deep copying
-    PriorityQueue(const PriorityQueue& other);
-    PriorityQueue& operator=(const PriorityQueue& other);
+    // capacity is only the initial reservation; the queue grows as needed
+    PriorityQueue(int capacity = 16);
+
+    // Bulk construction: heapify items[i] with priorities[i] in O(n)
+    PriorityQueue(DynamicArray<T>&& items, const DynamicArray<int>& priorities);
 
     void enqueue(const T& item, int priority);
+    void enqueue(T&& item, int priority);
     T dequeue();           // Removes item with highest priority
     T peek() const;        // Peek item with highest priority
     bool isEmpty() const;
-    bool isFull() const;
+    bool isFull() const;   // Never full; kept for existing callers
     int getSize() const;
+    void reserve(int capacity);
     void display() const;  // Display all items in priority order
     void clear();          // Clear the priority queue
-    
-    // Method to get all items with their priorities
+
+    // Replace the contents in one O(n) pass (Floyd's heap construction);
+    // ties keep the order of the input, as if enqueued one by one
+    void assign(DynamicArray<T>&& items, const DynamicArray<int>& priorities);
+    void assign(const T items[], const int priorities[], int count);
+
+    // Move every item out in dequeue order, leaving the queue empty
+    DynamicArray<T> drainSorted();
+
+    // Copy out all items with their priorities, in dequeue order
     void getAllItemsWithPriority(T items[], int priorities[], int& count) const;
+
+    // Keyed access (indexed queues only)
+    bool contains(const Key& key) const;
+    const T* find(const Key& key) const;         // nullptr if not queued
+    int getPriority(const Key& key) const;       // -1 if not queued
+    bool updatePriority(const Key& key, int newPriority);
+    bool erase(const Key& key);
 };
 
-template <typename T>
-PriorityQueue<T>::PriorityQueue(int cap) {
-    capacity = cap;
-    size = 0;
-    heap = new Node*[capacity];
-    for (int i = 0; i < capacity; i++) {
-        heap[i] = nullptr;
-    }
+template <typename T, typename KeyOf>
+PriorityQueue<T, KeyOf>::PriorityQueue(int capacity) : heap(capacity), nextSeq(0) {}
+
+template <typename T, typename KeyOf>
+PriorityQueue<T, KeyOf>::PriorityQueue(DynamicArray<T>&& items, const DynamicArray<int>& priorities)
+    : heap(items.getSize()), nextSeq(0) {
+    assign(std::move(items), priorities);
 }
 
-template <typename T>
-PriorityQueue<T>::~PriorityQueue() {
-    for (int i = 0; i < size; i++) {
-        delete heap[i];
-    }
-    delete[] heap;
+template <typename T, typename KeyOf>
+bool PriorityQueue<T, KeyOf>::higher(const Node& a, const Node& b) {
+    if (a.priority != b.priority) return a.priority > b.priority;
+    return a.seq < b.seq;
 }
 
-template <typename T>
-PriorityQueue<T>::PriorityQueue(const PriorityQueue& other) {
-    capacity = other.capacity;
-    size = other.size;
-    heap = new Node*[capacity];
-    
-    for (int i = 0; i < capacity; i++) {
-        heap[i] = nullptr;
+template <typename T, typename KeyOf>
+typename PriorityQueue<T, KeyOf>::Key PriorityQueue<T, KeyOf>::keyOf(const T& item) {
+    if constexpr (Traits::indexed) {
+        return KeyOf()(item);
+    } else {
+        (void)item;
+        return Key();
     }
-    
-    for (int i = 0; i < size; i++) {
-        heap[i] = new Node{other.heap[i]->data, other.heap[i]->priority};
+}
+
+// Move a node into a heap slot, keeping the key index pointing at it
+template <typename T, typename KeyOf>
+void PriorityQueue<T, KeyOf>::place(int index, Node&& node) {
+    heap[index] = std::move(node);
+    if constexpr (Traits::indexed) {
+        slots[keyOf(heap[index].data)] = index;
     }
 }
 
-template <typename T>
-PriorityQueue<T>& PriorityQueue<T>::operator=(const PriorityQueue& other) {
-    if (this != &other) {
-        // Clean up existing data
-        for (int i = 0; i < size; i++) {
-            delete heap[i];
-        }
-        delete[] heap;
-        
-        // Copy from other
-        capacity = other.capacity;
-        size = other.size;
-        heap = new Node*[capacity];
-        
-        for (int i = 0; i < capacity; i++) {
-            heap[i] = nullptr;
-        }
-        
-        for (int i = 0; i < size; i++) {
-            heap[i] = new Node{other.heap[i]->data, other.heap[i]->priority};
-        }
+template <typename T, typename KeyOf>
+int PriorityQueue<T, KeyOf>::slotOf(const Key& key) const {
+    static_assert(Traits::indexed, "keyed access needs a KeyOf functor");
+    const int* slot = slots.find(key);
+    return slot ? *slot : -1;
+}
+
+// Pointers to every node, sorted the way dequeue() would hand them out
+template <typename T, typename KeyOf>
+DynamicArray<const typename PriorityQueue<T, KeyOf>::Node*> PriorityQueue<T, KeyOf>::inDequeueOrder() const {
+    DynamicArray<const Node*> ordered(heap.getSize());
+    for (const Node& node : heap) {
+        ordered.push_back(&node);
     }
-    return *this;
+    std::sort(ordered.begin(), ordered.end(), [](const Node* a, const Node* b) { return higher(*a, *b); });
+    return ordered;
 }
 
-template <typename T>
-bool PriorityQueue<T>::isEmpty() const {
-    return size == 0;
+template <typename T, typename KeyOf>
+bool PriorityQueue<T, KeyOf>::isEmpty() const {
+    return heap.empty();
 }
 
-template <typename T>
-bool PriorityQueue<T>::isFull() const {
-    return size == capacity;
+template <typename T, typename KeyOf>
+bool PriorityQueue<T, KeyOf>::isFull() const {
+    return false;
 }
 
-template <typename T>
-int PriorityQueue<T>::getSize() const {
-    return size;
+template <typename T, typename KeyOf>
+int PriorityQueue<T, KeyOf>::getSize() const {
+    return heap.getSize();
 }
 
-template <typename T>
-void PriorityQueue<T>::swap(Node*& a, Node*& b) {
-    Node* temp = a;
-    a = b;
-    b = temp;
+template <typename T, typename KeyOf>
+void PriorityQueue<T, KeyOf>::reserve(int capacity) {
+    heap.reserve(capacity);
 }
 
-template <typename T>
-void PriorityQueue<T>::heapifyUp(int index) {
+// Sift the node at index up, moving parents down into the hole
+template <typename T, typename KeyOf>
+void PriorityQueue<T, KeyOf>::heapifyUp(int index) {
+    Node moving = std::move(heap[index]);
     while (index > 0) {
-        int parent = (index - 1) / 2;
-        if (heap[index]->priority > heap[parent]->priority) {
-            swap(heap[index], heap[parent]);
-            index = parent;
-        } else {
-            break;
-        }
+        int parent = (index - 1) / ARITY;
+        if (!higher(moving, heap[parent])) break;
+        place(index, std::move(heap[parent]));
+        index = parent;
     }
+    place(index, std::move(moving));
 }
 
-template <typename T>
-void PriorityQueue<T>::heapifyDown(int index) {
+// Sift the node at index down, moving the best child up into the hole
+template <typename T, typename KeyOf>
+void PriorityQueue<T, KeyOf>::heapifyDown(int index) {
+    int size = heap.getSize();
+    Node moving = std::move(heap[index]);
     while (true) {
-        int left = 2 * index + 1;
-        int right = 2 * index + 2;
-        int largest = index;
-
-        if (left < size && heap[left]->priority > heap[largest]->priority)
-            largest = left;
-        if (right < size && heap[right]->priority > heap[largest]->priority)
-            largest = right;
-
-        if (largest != index) {
-            swap(heap[index], heap[largest]);
-            index = largest;
+        int firstChild = ARITY * index + 1;
+        if (firstChild >= size) break;
+
+        int best = firstChild;
+        int lastChild = std::min(firstChild + ARITY, size);
+        for (int child = firstChild + 1; child < lastChild; ++child) {
+            if (higher(heap[child], heap[best])) best = child;
+        }
+
+        if (!higher(heap[best], moving)) break;
+        place(index, std::move(heap[best]));
+        index = best;
+    }
+    place(index, std::move(moving));
+}
+
+// Remove the node at index, filling the hole with the last node
+template <typename T, typename KeyOf>
+void PriorityQueue<T, KeyOf>::removeAt(int index) {
+    if constexpr (Traits::indexed) {
+        slots.erase(keyOf(heap[index].data));
+    }
+
+    int last = heap.getSize() - 1;
+    if (index != last) {
+        heap[index] = std::move(heap[last]);
+        heap.pop_back();
+        // The replacement may belong above or below the hole
+        if (index > 0 && higher(heap[index], heap[(index - 1) / ARITY])) {
+            heapifyUp(index);
         } else {
-            break;
+            heapifyDown(index);
         }
+    } else {
+        heap.pop_back();
     }
 }
 
-template <typename T>
-void PriorityQueue<T>::enqueue(const T& item, int priority) {
-    if (isFull()) {
-        std::cerr << "Queue is full. Cannot enqueue.\n";
-        return;
+// Restore the heap property over the whole array bottom-up, then index it
+template <typename T, typename KeyOf>
+void PriorityQueue<T, KeyOf>::buildHeap() {
+    int size = heap.getSize();
+    for (int index = (size - 2) / ARITY; index >= 0 && size > 1; --index) {
+        heapifyDown(index);
+    }
+    if constexpr (Traits::indexed) {
+        slots.clear();
+        slots.reserve(size);
+        for (int index = 0; index < size; ++index) {
+            slots[keyOf(heap[index].data)] = index;
+        }
     }
-    heap[size] = new Node{item, priority};
-    size++;
-    heapifyUp(size - 1);
 }
 
-template <typename T>
-T PriorityQueue<T>::dequeue() {
+template <typename T, typename KeyOf>
+void PriorityQueue<T, KeyOf>::assign(DynamicArray<T>&& items, const DynamicArray<int>& priorities) {
+    clear();
+    int count = std::min(items.getSize(), priorities.getSize());
+    heap.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        if constexpr (Traits::indexed) {
+            // A repeated key overwrites the earlier entry, like enqueue() would
+            const int* existing = slots.find(keyOf(items[i]));
+            if (existing) {
+                heap[*existing].data = std::move(items[i]);
+                heap[*existing].priority = priorities[i];
+                continue;
+            }
+            slots[keyOf(items[i])] = heap.getSize();
+        }
+        heap.push_back(Node{std::move(items[i]), priorities[i], nextSeq++});
+    }
+    items.clear();
+    buildHeap();
+}
+
+template <typename T, typename KeyOf>
+void PriorityQueue<T, KeyOf>::assign(const T items[], const int priorities[], int count) {
+    DynamicArray<T> copies(count);
+    DynamicArray<int> copiedPriorities(count);
+    for (int i = 0; i < count; ++i) {
+        copies.push_back(items[i]);
+        copiedPriorities.push_back(priorities[i]);
+    }
+    assign(std::move(copies), copiedPriorities);
+}
+
+template <typename T, typename KeyOf>
+DynamicArray<T> PriorityQueue<T, KeyOf>::drainSorted() {
+    std::sort(heap.begin(), heap.end(), [](const Node& a, const Node& b) { return higher(a, b); });
+
+    DynamicArray<T> items(heap.getSize());
+    for (Node& node : heap) {
+        items.push_back(std::move(node.data));
+    }
+    clear();
+    return items;
+}
+
+template <typename T, typename KeyOf>
+void PriorityQueue<T, KeyOf>::enqueue(const T& item, int priority) {
+    enqueue(T(item), priority);
+}
+
+template <typename T, typename KeyOf>
+void PriorityQueue<T, KeyOf>::enqueue(T&& item, int priority) {
+    if constexpr (Traits::indexed) {
+        int existing = slotOf(keyOf(item));
+        if (existing != -1) {
+            // Same key already queued: refresh its data, keep its place in line
+            heap[existing].data = std::move(item);
+            updatePriority(keyOf(heap[existing].data), priority);
+            return;
+        }
+    }
+    heap.push_back(Node{std::move(item), priority, nextSeq++});
+    heapifyUp(heap.getSize() - 1);
+}
+
+template <typename T, typename KeyOf>
+T PriorityQueue<T, KeyOf>::dequeue() {
     if (isEmpty()) return T(); // or throw
-    T item = heap[0]->data;
-    delete heap[0];
-    heap[0] = heap[size - 1];
-    heap[size - 1] = nullptr;
-    size--;
-    if (size > 0) {
+    T item = std::move(heap[0].data);
+    if constexpr (Traits::indexed) {
+        slots.erase(keyOf(item));
+    }
+    if (heap.getSize() > 1) {
+        heap[0] = std::move(heap.back());
+        heap.pop_back();
         heapifyDown(0);
+    } else {
+        heap.pop_back();
     }
     return item;
 }
 
-template <typename T>
-T PriorityQueue<T>::peek() const {
+template <typename T, typename KeyOf>
+T PriorityQueue<T, KeyOf>::peek() const {
     if (isEmpty()) return T();
-    return heap[0]->data;
+    return heap[0].data;
 }
 
-template <typename T>
-void PriorityQueue<T>::display() const {
+template <typename T, typename KeyOf>
+void PriorityQueue<T, KeyOf>::display() const {
     if (isEmpty()) {
         std::cout << "Priority Queue is empty.\n";
         return;
     }
-    
+
+    DynamicArray<const Node*> ordered = inDequeueOrder();
+
     std::cout << "Priority Queue contents (Priority: Data):\n";
-    for (int i = 0; i < size; i++) {
-        std::cout << "Priority " << heap[i]->priority << ": " << heap[i]->data << "\n";
+    for (const Node* node : ordered) {
+        std::cout << "Priority " << node->priority << ": " << node->data << "\n";
     }
-    std::cout << "Total items: " << size << "\n";
+    std::cout << "Total items: " << heap.getSize() << "\n";
 }
 
 // Clear the priority queue
-template <typename T>
-void PriorityQueue<T>::clear() {
-    for (int i = 0; i < size; i++) {
-        delete heap[i];
-    }
-    delete[] heap;
-    heap = new Node*[capacity];
-    for (int i = 0; i < capacity; i++) {
-        heap[i] = nullptr;
-    }
-    size = 0;
+template <typename T, typename KeyOf>
+void PriorityQueue<T, KeyOf>::clear() {
+    heap.clear();
+    slots.clear();
+    nextSeq = 0;
 }
 
 // Get all items with their priorities
-template <typename T>
-void PriorityQueue<T>::getAllItemsWithPriority(T items[], int priorities[], int& count) const {
-    count = size;
-    for (int i = 0; i < size; i++) {
-        items[i] = heap[i]->data;
-        priorities[i] = heap[i]->priority;
+template <typename T, typename KeyOf>
+void PriorityQueue<T, KeyOf>::getAllItemsWithPriority(T items[], int priorities[], int& count) const {
+    DynamicArray<const Node*> ordered = inDequeueOrder();
+
+    count = ordered.getSize();
+    for (int i = 0; i < count; i++) {
+        items[i] = ordered[i]->data;
+        priorities[i] = ordered[i]->priority;
+    }
+}
+
+template <typename T, typename KeyOf>
+bool PriorityQueue<T, KeyOf>::contains(const Key& key) const {
+    return slotOf(key) != -1;
+}
+
+template <typename T, typename KeyOf>
+const T* PriorityQueue<T, KeyOf>::find(const Key& key) const {
+    int index = slotOf(key);
+    return index == -1 ? nullptr : &heap[index].data;
+}
+
+template <typename T, typename KeyOf>
+int PriorityQueue<T, KeyOf>::getPriority(const Key& key) const {
+    int index = slotOf(key);
+    return index == -1 ? -1 : heap[index].priority;
+}
+
+// Change an entry's priority in O(log n); its arrival order is kept for ties
+template <typename T, typename KeyOf>
+bool PriorityQueue<T, KeyOf>::updatePriority(const Key& key, int newPriority) {
+    int index = slotOf(key);
+    if (index == -1) return false;
+
+    int oldPriority = heap[index].priority;
+    heap[index].priority = newPriority;
+    if (newPriority > oldPriority) {
+        heapifyUp(index);
+    } else if (newPriority < oldPriority) {
+        heapifyDown(index);
     }
+    return true;
+}
+
+template <typename T, typename KeyOf>
+bool PriorityQueue<T, KeyOf>::erase(const Key& key) {
+    int index = slotOf(key);
+    if (index == -1) return false;
+    removeAt(index);
+    return true;
 }
 
 #endif
@@ -0,0 +1,171 @@
+#ifndef SPSC_RING_QUEUE_HPP
+#define SPSC_RING_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include "DynamicArray.hpp"
+
+// Bounded lock-free queue for exactly one producer thread and one consumer
+// thread, e.g. a replay stream feeding a manager.
+//
+// Exposes the CircularQueue interface (enqueue / dequeue / peek throw when
+// full / empty) plus non-throwing tryEnqueue / tryDequeue, a spinning
+// enqueueBlocking and dequeueBatch. The head (consumer) and tail (producer)
+// indexes live on separate cache lines, and each side keeps a cached copy of
+// the other's index so it only touches the shared line when it looks
+// full / empty.
+//
+// Producer-side calls: enqueue, tryEnqueue, enqueueBlocking.
+// Consumer-side calls: dequeue, tryDequeue, dequeueBatch, peek, clear.
+// isEmpty / isFull / size may be called from either side and are exact only
+// when the other side is idle.
+template <typename T>
+class SpscRingQueue {
+private:
+    static const std::size_t CACHE_LINE = 64;
+
+    struct alignas(CACHE_LINE) ProducerSide {
+        std::atomic<std::size_t> tail;  // Next slot to write
+        std::size_t cachedHead;
+    };
+
+    struct alignas(CACHE_LINE) ConsumerSide {
+        std::atomic<std::size_t> head;  // Next slot to read
+        std::size_t cachedTail;
+    };
+
+    ProducerSide producer;
+    ConsumerSide consumer;
+    std::size_t capacity;  // Power of two
+    std::size_t mask;
+    T* slots;
+
+    static std::size_t roundUp(int requested) {
+        std::size_t size = 2;
+        while (size < static_cast<std::size_t>(requested > 0 ? requested : 1)) size *= 2;
+        return size;
+    }
+
+    template <typename U>
+    bool tryPush(U&& item) {
+        std::size_t tail = producer.tail.load(std::memory_order_relaxed);
+        if (tail - producer.cachedHead == capacity) {
+            producer.cachedHead = consumer.head.load(std::memory_order_acquire);
+            if (tail - producer.cachedHead == capacity) return false;
+        }
+        ::new (static_cast<void*>(slots + (tail & mask))) T(std::forward<U>(item));
+        producer.tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+public:
+    // Capacity is rounded up to a power of two (default 100 -> 128)
+    explicit SpscRingQueue(int size = 100)
+        : capacity(roundUp(size)), mask(capacity - 1),
+          slots(static_cast<T*>(::operator new(sizeof(T) * capacity))) {
+        producer.tail.store(0, std::memory_order_relaxed);
+        producer.cachedHead = 0;
+        consumer.head.store(0, std::memory_order_relaxed);
+        consumer.cachedTail = 0;
+    }
+
+    SpscRingQueue(const SpscRingQueue&) = delete;
+    SpscRingQueue& operator=(const SpscRingQueue&) = delete;
+
+    ~SpscRingQueue() {
+        clear();
+        ::operator delete(slots);
+    }
+
+    bool tryEnqueue(const T& item) { return tryPush(item); }
+    bool tryEnqueue(T&& item) { return tryPush(std::move(item)); }
+
+    // Wait (spinning, then yielding) until there is room
+    void enqueueBlocking(const T& item) {
+        T copy(item);
+        enqueueBlocking(std::move(copy));
+    }
+
+    void enqueueBlocking(T&& item) {
+        for (int spins = 0; !tryPush(std::move(item)); ++spins) {
+            if (spins > 64) std::this_thread::yield();
+        }
+    }
+
+    void enqueue(const T& item) {
+        if (!tryPush(item)) {
+            throw std::overflow_error("SpscRingQueue::enqueue: queue is full");
+        }
+    }
+
+    bool tryDequeue(T& out) {
+        std::size_t head = consumer.head.load(std::memory_order_relaxed);
+        if (head == consumer.cachedTail) {
+            consumer.cachedTail = producer.tail.load(std::memory_order_acquire);
+            if (head == consumer.cachedTail) return false;
+        }
+        T& slot = slots[head & mask];
+        out = std::move(slot);
+        slot.~T();
+        consumer.head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    T dequeue() {
+        T item;
+        if (!tryDequeue(item)) {
+            throw std::underflow_error("SpscRingQueue::dequeue: queue is empty");
+        }
+        return item;
+    }
+
+    // Move up to maxItems (all available if maxItems <= 0) into out;
+    // returns how many were taken
+    int dequeueBatch(DynamicArray<T>& out, int maxItems = 0) {
+        std::size_t head = consumer.head.load(std::memory_order_relaxed);
+        consumer.cachedTail = producer.tail.load(std::memory_order_acquire);
+        std::size_t available = consumer.cachedTail - head;
+        if (maxItems > 0 && available > static_cast<std::size_t>(maxItems)) {
+            available = static_cast<std::size_t>(maxItems);
+        }
+        out.reserve(out.getSize() + static_cast<int>(available));
+        for (std::size_t i = 0; i < available; ++i) {
+            T& slot = slots[(head + i) & mask];
+            out.push_back(std::move(slot));
+            slot.~T();
+        }
+        consumer.head.store(head + available, std::memory_order_release);
+        return static_cast<int>(available);
+    }
+
+    T peek() const {
+        std::size_t head = consumer.head.load(std::memory_order_relaxed);
+        if (head == producer.tail.load(std::memory_order_acquire)) {
+            throw std::underflow_error("SpscRingQueue::peek: queue is empty");
+        }
+        return slots[head & mask];
+    }
+
+    // Drop everything currently queued
+    void clear() {
+        T discarded;
+        while (tryDequeue(discarded)) {}
+    }
+
+    bool isEmpty() const { return size() == 0; }
+    bool isFull() const { return size() == static_cast<int>(capacity); }
+
+    int size() const {
+        std::size_t head = consumer.head.load(std::memory_order_acquire);
+        std::size_t tail = producer.tail.load(std::memory_order_acquire);
+        return static_cast<int>(tail - head);
+    }
+
+    int getCapacity() const { return static_cast<int>(capacity); }
+};
+
+#endif
@@ -1,69 +1,245 @@
 #ifndef STACK_HPP
 #define STACK_HPP
 
+#include <new>
+#include <utility>
+
+// LIFO stack on raw storage that grows geometrically, so pushes never drop
+// data. Nothing is allocated until the first push, and the first block holds
+// initialCapacity items, so a small stack costs no more than before.
+//
+// Optionally the stack can be bounded ("keep last N"): once it holds
+// keepLast items, each push silently discards the oldest one. The items then
+// live in a ring, so discarding is O(1).
 template <typename T>
 class Stack {
 private:
-    int capacity;
-    int topIndex;
     T* data;
+    int capacity;
+    int count;
+    int bottom;        // Slot of the oldest item (only moves in bounded mode)
+    int initialCapacity;
+    int keepLast;      // 0 = unbounded
+    long long dropped; // Items discarded by bounded mode
+
+    int slotOf(int position) const;
+    void reallocate(int newCapacity);
+    T* prepareSlot();
 
 public:
-    Stack(int size = 100);
+    explicit Stack(int initialCapacity = 100, int keepLast = 0);
+    Stack(const Stack& other);
+    Stack(Stack&& other) noexcept;
+    Stack& operator=(const Stack& other);
+    Stack& operator=(Stack&& other) noexcept;
     ~Stack();
 
+    void swap(Stack& other) noexcept;
+
     void push(const T& item);
+    void push(T&& item);
+    template <typename... Args>
+    T& emplace(Args&&... args);
     T pop();
     T peek() const;
 
+    void reserve(int newCapacity);
+    void clear();
+
     bool isEmpty() const;
-    bool isFull() const;
+    bool isFull() const;   // Only ever true for a bounded stack at its limit
+    bool isBounded() const;
     int size() const;
+    int getCapacity() const;
+    long long getDroppedCount() const;
 };
 
 template <typename T>
-Stack<T>::Stack(int size) {
-    capacity = size;
-    topIndex = -1;
-    data = new T[capacity];
+Stack<T>::Stack(int initialCapacity, int keepLast)
+    : data(nullptr), capacity(0), count(0), bottom(0),
+      initialCapacity(initialCapacity > 0 ? initialCapacity : 1),
+      keepLast(keepLast > 0 ? keepLast : 0), dropped(0) {
+    if (this->keepLast && this->initialCapacity > this->keepLast) {
+        this->initialCapacity = this->keepLast;
+    }
+}
+
+template <typename T>
+Stack<T>::Stack(const Stack& other)
+    : data(nullptr), capacity(0), count(0), bottom(0),
+      initialCapacity(other.initialCapacity), keepLast(other.keepLast), dropped(other.dropped) {
+    reserve(other.count);
+    for (int i = 0; i < other.count; ++i) {
+        ::new (static_cast<void*>(data + i)) T(other.data[other.slotOf(i)]);
+        count++;
+    }
+}
+
+template <typename T>
+Stack<T>::Stack(Stack&& other) noexcept
+    : data(other.data), capacity(other.capacity), count(other.count), bottom(other.bottom),
+      initialCapacity(other.initialCapacity), keepLast(other.keepLast), dropped(other.dropped) {
+    other.data = nullptr;
+    other.capacity = 0;
+    other.count = 0;
+    other.bottom = 0;
+    other.dropped = 0;
+}
+
+template <typename T>
+Stack<T>& Stack<T>::operator=(const Stack& other) {
+    if (this != &other) {
+        Stack copy(other);
+        swap(copy);
+    }
+    return *this;
+}
+
+template <typename T>
+Stack<T>& Stack<T>::operator=(Stack&& other) noexcept {
+    if (this != &other) {
+        Stack moved(std::move(other));
+        swap(moved);
+    }
+    return *this;
 }
 
 template <typename T>
 Stack<T>::~Stack() {
-    delete[] data;
+    clear();
+    ::operator delete(data);
+}
+
+template <typename T>
+void Stack<T>::swap(Stack& other) noexcept {
+    std::swap(data, other.data);
+    std::swap(capacity, other.capacity);
+    std::swap(count, other.count);
+    std::swap(bottom, other.bottom);
+    std::swap(initialCapacity, other.initialCapacity);
+    std::swap(keepLast, other.keepLast);
+    std::swap(dropped, other.dropped);
+}
+
+// Storage slot of the item `position` places above the bottom
+template <typename T>
+int Stack<T>::slotOf(int position) const {
+    int slot = bottom + position;
+    return slot >= capacity ? slot - capacity : slot;
+}
+
+// Move the items, oldest first, into a fresh block of newCapacity slots
+template <typename T>
+void Stack<T>::reallocate(int newCapacity) {
+    T* newData = static_cast<T*>(::operator new(sizeof(T) * newCapacity));
+    for (int i = 0; i < count; ++i) {
+        T& item = data[slotOf(i)];
+        ::new (static_cast<void*>(newData + i)) T(std::move(item));
+        item.~T();
+    }
+    ::operator delete(data);
+    data = newData;
+    capacity = newCapacity;
+    bottom = 0;
+}
+
+// Free slot for the next push, growing or (in bounded mode) evicting the oldest
+template <typename T>
+T* Stack<T>::prepareSlot() {
+    if (keepLast && count == keepLast) {
+        data[bottom].~T();
+        bottom = slotOf(1);
+        count--;
+        dropped++;
+    } else if (count == capacity) {
+        int newCapacity = capacity > 0 ? capacity * 2 : initialCapacity;
+        if (keepLast && newCapacity > keepLast) newCapacity = keepLast;
+        reallocate(newCapacity);
+    }
+    return data + slotOf(count);
 }
 
 template <typename T>
 void Stack<T>::push(const T& item) {
-    if (isFull()) return; // optionally throw
-    data[++topIndex] = item;
+    emplace(item);
+}
+
+template <typename T>
+void Stack<T>::push(T&& item) {
+    emplace(std::move(item));
+}
+
+template <typename T>
+template <typename... Args>
+T& Stack<T>::emplace(Args&&... args) {
+    // Build first: args may refer to an item that growth or eviction would move
+    T item(std::forward<Args>(args)...);
+    T* slot = ::new (static_cast<void*>(prepareSlot())) T(std::move(item));
+    count++;
+    return *slot;
 }
 
 template <typename T>
 T Stack<T>::pop() {
     if (isEmpty()) return T(); // or throw
-    return data[topIndex--];
+    T& top = data[slotOf(count - 1)];
+    T item(std::move(top));
+    top.~T();
+    count--;
+    return item;
 }
 
 template <typename T>
 T Stack<T>::peek() const {
     if (isEmpty()) return T(); // or throw
-    return data[topIndex];
+    return data[slotOf(count - 1)];
+}
+
+template <typename T>
+void Stack<T>::reserve(int newCapacity) {
+    if (keepLast && newCapacity > keepLast) newCapacity = keepLast;
+    if (newCapacity > capacity) {
+        reallocate(newCapacity);
+    }
+}
+
+template <typename T>
+void Stack<T>::clear() {
+    for (int i = 0; i < count; ++i) {
+        data[slotOf(i)].~T();
+    }
+    count = 0;
+    bottom = 0;
 }
 
 template <typename T>
 bool Stack<T>::isEmpty() const {
-    return topIndex == -1;
+    return count == 0;
 }
 
 template <typename T>
 bool Stack<T>::isFull() const {
-    return topIndex == capacity - 1;
+    return keepLast && count == keepLast;
+}
+
+template <typename T>
+bool Stack<T>::isBounded() const {
+    return keepLast != 0;
 }
 
 template <typename T>
 int Stack<T>::size() const {
-    return topIndex + 1;
+    return count;
+}
+
+template <typename T>
+int Stack<T>::getCapacity() const {
+    return capacity;
+}
+
+template <typename T>
+long long Stack<T>::getDroppedCount() const {
+    return dropped;
 }
 
 #endif
@@ -0,0 +1,119 @@
+#include "functions/ChampionAnalytics.hpp"
+#include <cctype>
+#include <cstdint>
+#include "structures/DynamicArray.hpp"
+
+static_assert(ChampionAnalytics::CHAMPIONS < ChampionAnalytics::SLOTS, "Champion matrix rows are too narrow");
+
+ChampionAnalytics::ChampionAnalytics() {
+    clear();
+}
+
+void ChampionAnalytics::clear() {
+    for (int& count : wins) {
+        count = 0;
+    }
+    results = 0;
+}
+
+void ChampionAnalytics::restore(const int* counts) {
+    results = 0;
+    for (int i = 0; i < SLOTS * SLOTS; ++i) {
+        wins[i] = counts[i];
+        results += counts[i];
+    }
+}
+
+int ChampionAnalytics::encode(const JoinedRow& row) {
+    if (!row.match) return -1;
+    int champion1 = static_cast<int>(row.result->championsP1);
+    int champion2 = static_cast<int>(row.result->championsP2);
+    if (champion1 < 0 || champion1 > CHAMPIONS || champion2 < 0 || champion2 > CHAMPIONS) return -1;
+
+    if (row.player1Won()) return champion1 * SLOTS + champion2;
+    if (row.player2Won()) return champion2 * SLOTS + champion1;
+    return -1;
+}
+
+void ChampionAnalytics::record(const JoinedRow& row) {
+    int code = encode(row);
+    if (code < 0) return;
+    wins[code]++;
+    results++;
+}
+
+void ChampionAnalytics::rebuild(const ResultJoin& join, int count) {
+    clear();
+
+    // Pass 1: one byte per countable result. Joining is the expensive part;
+    // it is kept out of the counting loop.
+    DynamicArray<std::uint8_t> codes(count);
+    for (int i = 0; i < count; ++i) {
+        int code = encode(join.row(i));
+        if (code >= 0) codes.push_back(static_cast<std::uint8_t>(code));
+    }
+
+    // Pass 2: stream the codes into four partial matrices, so runs of the
+    // same matchup do not wait on each other's increments, then merge them
+    alignas(64) int partial[4][SLOTS * SLOTS] = {};
+    const std::uint8_t* code = codes.begin();
+    int total = codes.getSize();
+    int i = 0;
+    for (; i + 4 <= total; i += 4) {
+        partial[0][code[i]]++;
+        partial[1][code[i + 1]]++;
+        partial[2][code[i + 2]]++;
+        partial[3][code[i + 3]]++;
+    }
+    for (; i < total; ++i) {
+        partial[0][code[i]]++;
+    }
+    for (int cell = 0; cell < SLOTS * SLOTS; ++cell) {
+        wins[cell] = partial[0][cell] + partial[1][cell] + partial[2][cell] + partial[3][cell];
+    }
+    results = total;
+}
+
+int ChampionAnalytics::getWins(Champion winner, Champion loser) const {
+    return wins[static_cast<int>(winner) * SLOTS + static_cast<int>(loser)];
+}
+
+int ChampionAnalytics::getWins(Champion champion) const {
+    const int* row = wins + static_cast<int>(champion) * SLOTS;
+    int total = 0;
+    for (int loser = 0; loser < SLOTS; ++loser) {
+        total += row[loser];
+    }
+    return total;
+}
+
+int ChampionAnalytics::getLosses(Champion champion) const {
+    int column = static_cast<int>(champion);
+    int total = 0;
+    for (int winner = 0; winner < SLOTS; ++winner) {
+        total += wins[winner * SLOTS + column];
+    }
+    return total;
+}
+
+float ChampionAnalytics::getWinRate(Champion champion) const {
+    int picks = getPicks(champion);
+    return picks > 0 ? (static_cast<float>(getWins(champion)) / picks) * 100.0f : 0.0f;
+}
+
+bool ChampionAnalytics::parseChampion(const std::string& text, Champion& champion) {
+    for (int i = 0; i < CHAMPIONS; ++i) {
+        std::string_view name = toString(static_cast<Champion>(i));
+        if (name.size() != text.size()) continue;
+
+        bool same = true;
+        for (std::size_t j = 0; j < name.size() && same; ++j) {
+            same = std::tolower(static_cast<unsigned char>(name[j])) == std::tolower(static_cast<unsigned char>(text[j]));
+        }
+        if (same) {
+            champion = static_cast<Champion>(i);
+            return true;
+        }
+    }
+    return false;
+}
@@ -1,10 +1,16 @@
 #include <iostream>
 #include <string>
 #include <iomanip>
+#include <algorithm>
 #include <cstdlib>
 #include <ctime>
+#include <cstdint>
+#include <string_view>
 #include "functions/GameResultLogger.hpp"
 #include "helper/JsonLoader.hpp"
+#include "helper/ResultEvents.hpp"
+#include "helper/SnapshotFile.hpp"
+#include "helper/WriteBehindCache.hpp"
 #include "dto/Match.hpp"
 #include "dto/Result.hpp"
 #include "dto/Performance.hpp"
@@ -17,44 +23,48 @@ GameResultLogger::GameResultLogger()
   : loadedResultsCount(0)
   , searchResultsStack(50)                    // Stack for search results
   , playerAnalysisStack(100)                  // Stack for player analysis  
-  , operationHistoryStack(100)                // Stack for operation history
+  , operationHistoryStack(16, 100)            // Operation history, keeps the last 100
+  , operationLog(1000)                        // Audit trail, oldest chunks evicted
   , processingStack(50)                       // Stack for general processing
-  , playerCount(0) {
+  , checkpointFile("data/stats_checkpoint.json")
+  , statsIngested(0)
+  , statsGeneration(0)
+  , checkpointedCount(0)
+  , resultSubscription(0) {
     
-    // Initialize player statistics array
-    for (int i = 0; i < MAX_PLAYERS; ++i) {
-        playerStatistics[i] = PlayerStats();
-    }
+    // Start with an empty statistics table
+    resetPlayerStatistics();
     
     // Automatically load results from JSON into DoublyLinkedList on initialization
     // std::cout << "Task 4: Loading game results from JSON into DoublyLinkedList...\n";
     loadResultsFromJSON();
+    
+    // Count each result as it is saved. The store subscribed first (it is
+    // constructed before this body runs), so it already holds the result;
+    // joining it needs no file check, which would flush pending saves.
+    resultSubscription = ResultEvents::subscribe([this](const std::string& filename, const Result&) {
+        if (filename != resultStore.getFilename()) return;
+        resultJoin.extend();
+        applyJoinedResults();
+    });
     recordOperation("Task 4 system initialized - DoublyLinkedList + Stack ready");
 }
 
 GameResultLogger::~GameResultLogger() {
-    // Destructor - DoublyLinkedList and Stack will clean themselves up automatically
+    ResultEvents::unsubscribe(resultSubscription);
+    if (statsIngested != checkpointedCount) updatePlayerStatistics();
+    if (statsIngested != checkpointedCount) saveStatsCheckpoint();
 }
 
 int GameResultLogger::findPlayerIndex(const std::string& playerId) const {
-    for (int i = 0; i < playerCount; ++i) {
-        if (playerStatistics[i].playerId == playerId) {
-            return i;
-        }
-    }
-    return -1; // Not found
+    return statsTable.find(playerId); // -1 if not found
 }
 
-std::string GameResultLogger::stageToString(TournamentStage stage) const {
-    switch (stage) {
-        case TournamentStage::Registration: return "Registration";
-        case TournamentStage::Qualifiers: return "Qualifiers";
-        case TournamentStage::Quarterfinals: return "Quarterfinals";
-        case TournamentStage::Semifinals: return "Semifinals";
-        case TournamentStage::Finals: return "Finals";
-        case TournamentStage::Completed: return "Completed";
-        default: return "Unknown Stage";
-    }
+// Slot of the player's statistics, started if this is their first result
+int GameResultLogger::addPlayerStats(const std::string& playerId, const Player* player) {
+    int index = statsTable.find(playerId);
+    if (index != -1) return index;
+    return statsTable.findOrAdd(playerId, player ? player->name : "Player" + playerId);
 }
 
 // ===============================================
@@ -70,100 +80,281 @@ void GameResultLogger::loadResultsFromJSON(const std::string& jsonPath) {
     recordOperation("Loading results using JsonLoader: " + jsonPath);
     
     // Use JsonLoader - it handles DoublyLinkedList internally
-    auto resultsList = JsonLoader::loadResults(jsonPath);
+    int resultCount = jsonPath == resultStore.getFilename() ? resultStore.current().getSize()
+                                                            : JsonLoader::loadResults(jsonPath).getSize();
     
-    if (resultsList.getSize() == 0) {
+    if (resultCount == 0) {
         recordOperation("JSON loading failed - no results found");
         loadedResultsCount = 0;
         return;
     }
     
-    loadedResultsCount = resultsList.getSize();
+    loadedResultsCount = resultCount;
     // std::cout << "JsonLoader successfully loaded " << loadedResultsCount << " results.\n";
     // std::cout << "JsonLoader manages DoublyLinkedList internally.\n";
     recordOperation("JSON loading completed - " + std::to_string(loadedResultsCount) + " results loaded via JsonLoader");
     
-    // Calculate player statistics from JsonLoader data
+    // Pick up from the last checkpoint, then count whatever came after it
+    if (statsIngested == 0) restoreStatsCheckpoint();
+    updatePlayerStatistics();
+}
+
+void GameResultLogger::refreshResults() {
+    recordOperation("Refreshing resident results from " + resultStore.getFilename());
+    resultStore.refresh();
+    loadedResultsCount = resultStore.current().getSize();
     calculatePlayerStatistics();
 }
 
+void GameResultLogger::displayResultStoreStats() const {
+    ResultStore::Counters counters = resultStore.getCounters();
+    std::cout << "\n=== RESULT STORE ===\n";
+    std::cout << "Results in memory: " << resultStore.current().getSize() << "\n";
+    std::cout << "Served from memory: " << counters.hits << "\n";
+    std::cout << "Full reloads: " << counters.reloads << "\n";
+    std::cout << "Appended-record reads: " << counters.tailReads << "\n";
+    std::cout << "Results received on save: " << counters.notified << "\n";
+}
+
 void GameResultLogger::calculatePlayerStatistics() {
     recordOperation("Calculating player statistics using JsonLoader");
+    resetPlayerStatistics();
+    updatePlayerStatistics();
+    recordOperation("Player statistics calculation completed using JsonLoader data");
+}
+
+void GameResultLogger::resetPlayerStatistics() {
+    statsTable.clear();
+    championAnalytics.clear();
+    statsIngested = 0;
+}
+
+void GameResultLogger::updatePlayerStatistics() {
+    resultJoin.sync();
+    applyJoinedResults();
     
-    // Get fresh data from JsonLoader (DoublyLinkedList handled internally)
-    auto resultsList = JsonLoader::loadResults("data/results.json");
-    if (resultsList.getSize() == 0) {
-        resultsList = JsonLoader::loadResults("data/results.json");
+    // Only now do the resident results match the files, which the
+    // checkpoint records
+    if (statsIngested - checkpointedCount >= CHECKPOINT_INTERVAL) saveStatsCheckpoint();
+}
+
+// Apply the joined rows added since the last call; O(1) per new result.
+// Only a rebuilt join (results reloaded, matches replaced) starts over.
+void GameResultLogger::applyJoinedResults() {
+    // Resident results joined to their matches and players
+    ResultJoin::Rows rows = resultJoin.joinedRows();
+    if (statsGeneration != resultJoin.getGeneration() || statsIngested > rows.getSize()) {
+        resetPlayerStatistics();
+        statsGeneration = resultJoin.getGeneration();
     }
     
-    // Reset player statistics
-    for (int i = 0; i < MAX_PLAYERS; ++i) {
-        playerStatistics[i] = PlayerStats();
+    if (rows.getSize() == statsIngested) return;
+    
+    int unmatchedBefore = resultJoin.getUnmatchedCount(statsIngested);
+    for (; statsIngested < rows.getSize(); ++statsIngested) {
+        ingestResult(resultJoin.row(statsIngested));
     }
-    playerCount = 0;
     
-    if (resultsList.getSize() == 0) {
-        recordOperation("No results available for statistics calculation");
+    int skipped = resultJoin.getUnmatchedCount() - unmatchedBefore;
+    if (skipped > 0) {
+        recordOperation(std::to_string(skipped) + " results skipped - match not found");
+    }
+}
+
+void GameResultLogger::ingestResult(const JoinedRow& row) {
+    if (!row.match) return;     // Match not in matches.json; players unknown
+    const Result& result = *row.result;
+    
+    // Find or create player statistics entries
+    int player1Index = addPlayerStats(row.match->player1, row.player1);
+    int player2Index = addPlayerStats(row.match->player2, row.player2);
+    
+    // Update statistics for both players. No analysis snapshot is pushed
+    // here: ingest runs for every result of the process's life, so the
+    // stack would hold two full copies per result.
+    statsTable.recordMatch(player1Index, row.player1Won(), result.championsP1, row.match->date, 30.0f);
+    statsTable.recordMatch(player2Index, row.player2Won(), result.championsP2, row.match->date, 30.0f);
+    
+    // Champion matchup matrix
+    championAnalytics.record(row);
+}
+
+// ===============================================
+// STATISTICS CHECKPOINT
+// ===============================================
+
+static json stampToJson(const FileWatch::Stamp& stamp) {
+    return json{
+        {"size", stamp.size},
+        {"hash", stamp.hash},
+        {"journalOffset", stamp.journalOffset},
+        {"journalInode", stamp.journalInode},
+        {"journalTailHash", stamp.journalTailHash}
+    };
+}
+
+static FileWatch::Stamp stampFromJson(const json& data) {
+    FileWatch::Stamp stamp;
+    stamp.size = data.at("size").get<std::uintmax_t>();
+    stamp.hash = data.at("hash").get<std::uint64_t>();
+    stamp.journalOffset = data.at("journalOffset").get<std::uintmax_t>();
+    stamp.journalInode = data.at("journalInode").get<std::uintmax_t>();
+    stamp.journalTailHash = data.at("journalTailHash").get<std::uint64_t>();
+    return stamp;
+}
+
+static bool isLoadedFrom(const FileWatch& watch, const json& data) {
+    FileWatch::Stamp stamp;
+    return watch.getStamp(stamp) && stamp == stampFromJson(data);
+}
+
+// Player statistics are checkpointed as one flat array, STATS_FIELDS values
+// per player in the order below: parsing plain values is several times
+// faster than one object per player, which would make a restore slower than
+// recounting the results. Win rate and favourite champion are left out;
+// PlayerStatsTable::set() derives them from the counts.
+static const int STATS_FIELDS = 9 + PlayerStats::CHAMPION_SLOTS;
+
+static void appendStats(json& rows, const PlayerStats& stats) {
+    rows.push_back(stats.playerId);
+    rows.push_back(stats.playerName);
+    rows.push_back(stats.totalMatches);
+    rows.push_back(stats.wins);
+    rows.push_back(stats.losses);
+    rows.push_back(stats.lastMatchDate);
+    rows.push_back(stats.currentWinStreak);
+    rows.push_back(stats.longestWinStreak);
+    rows.push_back(stats.averageGameDuration);
+    for (int count : stats.championUsageCount) {
+        rows.push_back(count);
+    }
+}
+
+static PlayerStats statsAt(const json& rows, std::size_t at) {
+    PlayerStats stats(rows[at].get<std::string>(), rows[at + 1].get<std::string>());
+    stats.totalMatches = rows[at + 2].get<int>();
+    stats.wins = rows[at + 3].get<int>();
+    stats.losses = rows[at + 4].get<int>();
+    stats.lastMatchDate = rows[at + 5].get<std::string>();
+    stats.currentWinStreak = rows[at + 6].get<int>();
+    stats.longestWinStreak = rows[at + 7].get<int>();
+    stats.averageGameDuration = rows[at + 8].get<float>();
+    for (int i = 0; i < PlayerStats::CHAMPION_SLOTS; ++i) {
+        stats.championUsageCount[i] = rows[at + 9 + i].get<int>();
+    }
+    return stats;
+}
+
+// Written in the background; records which results the statistics cover
+// (their count and first and last result id) and the stamps of the results,
+// matches and players files they were counted from, so a restart can tell
+// whether the checkpoint still applies without reading the rows. The table
+// is copied here and encoded on the write-behind thread.
+void GameResultLogger::saveStatsCheckpoint() {
+    const ChunkedLog<Result>& resultsList = resultStore.resident();
+    FileWatch::Stamp results, matches, players;
+    if (statsIngested == 0 || statsIngested != resultsList.getSize() ||
+        !resultStore.getWatch().getStamp(results) || !resultJoin.getMatchesWatch().getStamp(matches) ||
+        !resultJoin.getPlayersWatch().getStamp(players)) {
         return;
     }
     
-    // Analyze each result from JsonLoader's DoublyLinkedList
-    for (int i = 0; i < resultsList.getSize(); ++i) {
-        Result* result = resultsList.get(i);
-        if (!result) continue;
+    json matchups = json::array();
+    const int* counts = championAnalytics.getCounts();
+    for (int i = 0; i < ChampionAnalytics::SLOTS * ChampionAnalytics::SLOTS; ++i) {
+        matchups.push_back(counts[i]);
+    }
+    json coverage = {
+        {"results", statsIngested},
+        {"firstResultId", resultsList[0].id},
+        {"lastResultId", resultsList[statsIngested - 1].id},
+        {"files", {
+            {"results", stampToJson(results)},
+            {"matches", stampToJson(matches)},
+            {"players", stampToJson(players)}
+        }},
+        {"matchups", matchups}
+    };
+    WriteBehindCache::instance().markDirty(checkpointFile, [coverage, table = statsTable]() {
+        json checkpoint = coverage;
+        json& players = checkpoint["players"] = json::array();
+        players.get_ref<json::array_t&>().reserve(static_cast<std::size_t>(table.getSize()) * STATS_FIELDS);
+        for (int i = 0; i < table.getSize(); ++i) {
+            appendStats(players, table.get(i));
+        }
+        return SnapshotFile::encode(checkpoint, StorageFormat::MessagePack);
+    });
+    checkpointedCount = statsIngested;
+}
+
+// Load the checkpoint if the files it was counted from are unchanged, apart
+// from results appended since; the caller then applies only those
+bool GameResultLogger::restoreStatsCheckpoint() {
+    json checkpoint;
+    try {
+        if (!SnapshotFile::read(checkpointFile, checkpoint)) return false;
         
-        // Create approximate player IDs (since JsonLoader doesn't provide MatchPlayerInfo separately)
-        std::string player1Id = "P" + std::string(5 - std::to_string(100 + i).length(), '0') + std::to_string(100 + i);  // Format P00XXX
-        std::string player2Id = "P" + std::string(5 - std::to_string(200 + i).length(), '0') + std::to_string(200 + i);  // Format P00XXX
-        std::string winnerId = result->winnerId;
+        resultJoin.sync();
+        const ChunkedLog<Result>& resultsList = resultStore.resident();
+        int count = checkpoint.at("results").get<int>();
+        bool current = checkpoint.contains("files") && checkpoint.contains("matchups") &&
+                       count > 0 && count <= resultsList.getSize() &&
+                       resultsList[0].id == checkpoint.at("firstResultId").get<std::string>() &&
+                       resultsList[count - 1].id == checkpoint.at("lastResultId").get<std::string>();
         
-        // Find or create player statistics entries
-        int player1Index = findPlayerIndex(player1Id);
-        if (player1Index == -1 && playerCount < MAX_PLAYERS) {
-            playerStatistics[playerCount] = PlayerStats(player1Id, "Player" + player1Id);
-            player1Index = playerCount++;
+        // Compared by stamp, not row by row: the results file may only have
+        // grown by journal records, and matches and players must be exactly
+        // as counted, since they change how covered results join
+        if (current) {
+            const json& files = checkpoint.at("files");
+            current = resultStore.getWatch().startsWith(stampFromJson(files.at("results"))) &&
+                      isLoadedFrom(resultJoin.getMatchesWatch(), files.at("matches")) &&
+                      isLoadedFrom(resultJoin.getPlayersWatch(), files.at("players"));
         }
-        
-        int player2Index = findPlayerIndex(player2Id);
-        if (player2Index == -1 && playerCount < MAX_PLAYERS) {
-            playerStatistics[playerCount] = PlayerStats(player2Id, "Player" + player2Id);
-            player2Index = playerCount++;
+        if (!current) {
+            recordOperation("Statistics checkpoint is out of date - recounting");
+            return false;
         }
         
-        // Update statistics for player 1
-        if (player1Index != -1) {
-            bool player1Won = (winnerId == player1Id);
-            Champion player1Champion = (result->championsP1 != Champion::NoChampion) ?
-                                       result->championsP1 : Champion::NoChampion;
-            playerStatistics[player1Index].updateStats(player1Won, player1Champion, "2024-01-01", 30.0f);
-            
-            // Push to analysis stack
-            pushPlayerAnalysis(playerStatistics[player1Index]);
+        const json& matchups = checkpoint.at("matchups");
+        int counts[ChampionAnalytics::SLOTS * ChampionAnalytics::SLOTS];
+        if (matchups.size() != sizeof(counts) / sizeof(counts[0])) {
+            recordOperation("Statistics checkpoint is out of date - recounting");
+            return false;
+        }
+        for (std::size_t i = 0; i < matchups.size(); ++i) {
+            counts[i] = matchups[i].get<int>();
         }
         
-        // Update statistics for player 2
-        if (player2Index != -1) {
-            bool player2Won = (winnerId == player2Id);
-            Champion player2Champion = (result->championsP2 != Champion::NoChampion) ?
-                                       result->championsP2 : Champion::NoChampion;
-            playerStatistics[player2Index].updateStats(player2Won, player2Champion, "2024-01-01", 30.0f);
-            
-            // Push to analysis stack
-            pushPlayerAnalysis(playerStatistics[player2Index]);
+        resetPlayerStatistics();
+        const json& players = checkpoint.at("players");
+        if (!players.is_array() || players.size() % STATS_FIELDS != 0) {
+            throw std::runtime_error("player statistics are not " + std::to_string(STATS_FIELDS) + " values each");
+        }
+        statsTable.reserve(static_cast<int>(players.size() / STATS_FIELDS));
+        for (std::size_t at = 0; at < players.size(); at += STATS_FIELDS) {
+            PlayerStats stats = statsAt(players, at);
+            if (findPlayerIndex(stats.playerId) != -1) continue;
+            statsTable.set(addPlayerStats(stats.playerId, nullptr), stats);
         }
+        championAnalytics.restore(counts);
+        statsIngested = count;
+        statsGeneration = resultJoin.getGeneration();
+        checkpointedCount = count;
+    } catch (const std::exception& e) {
+        std::cerr << "Ignoring statistics checkpoint: " << e.what() << std::endl;
+        resetPlayerStatistics();
+        return false;
     }
-    
-    recordOperation("Player statistics calculation completed using JsonLoader data");
+    recordOperation("Statistics restored from checkpoint - " + std::to_string(statsIngested) + " results");
+    return true;
 }
 
 void GameResultLogger::displayLoadedResults() const {
     std::cout << "\n=== LOADED RESULTS FROM JSON (via JsonLoader) ===\n";
     
-    // Get fresh data from JsonLoader (DoublyLinkedList handled internally)
-    auto resultsList = JsonLoader::loadResults("data/results.json");
-    if (resultsList.getSize() == 0) {
-        resultsList = JsonLoader::loadResults("data/results.json");
-    }
+    // Resident results, re-read only when results.json changed on disk
+    const ChunkedLog<Result>& resultsList = resultStore.current();
     
     if (resultsList.getSize() == 0) {
         std::cout << "No results loaded from JSON.\n";
@@ -176,17 +367,14 @@ void GameResultLogger::displayLoadedResults() const {
     std::cout << std::string(58, '-') << "\n";
     
     // Use JsonLoader's DoublyLinkedList results
-    for (int i = 0; i < resultsList.getSize(); ++i) {
-        Result* result = resultsList.get(i);
-        if (!result) continue;
-        
+    for (const Result& result : resultsList) {
         // Get champion names for display
-        std::string champ1Str = championToString(result->championsP1);
-        std::string champ2Str = championToString(result->championsP2);
+        std::string_view champ1Str = toString(result.championsP1);
+        std::string_view champ2Str = toString(result.championsP2);
         
-        std::cout << std::setw(6) << result->id
-                  << std::setw(10) << result->matchId
-                  << std::setw(8) << result->winnerId
+        std::cout << std::setw(6) << result.id
+                  << std::setw(10) << result.matchId
+                  << std::setw(8) << result.winnerId
                   << std::setw(12) << champ1Str.substr(0, 11)
                   << champ2Str.substr(0, 11) << "\n";
     }
@@ -199,7 +387,7 @@ void GameResultLogger::displayLoadedResults() const {
 void GameResultLogger::displayPlayerMatchCount() const {
     std::cout << "\n=== PLAYER MATCH COUNT ANALYSIS ===\n";
     
-    if (playerCount == 0) {
+    if (statsTable.getSize() == 0) {
         std::cout << "No player data available. Load results first.\n";
         return;
     }
@@ -210,18 +398,16 @@ void GameResultLogger::displayPlayerMatchCount() const {
               << std::setw(10) << "Losses\n";
     std::cout << std::string(62, '-') << "\n";
     
-    int totalMatches = 0;
-    for (int i = 0; i < playerCount; ++i) {
-        const PlayerStats& stats = playerStatistics[i];
-        if (stats.totalMatches > 0) {
-            std::cout << std::setw(12) << stats.playerId
-                      << std::setw(20) << stats.playerName
-                      << std::setw(12) << stats.totalMatches
-                      << std::setw(8) << stats.wins
-                      << stats.losses << "\n";
-            totalMatches += stats.totalMatches;
+    for (int i = 0; i < statsTable.getSize(); ++i) {
+        if (statsTable.getTotalMatches(i) > 0) {
+            std::cout << std::setw(12) << statsTable.getPlayerId(i)
+                      << std::setw(20) << statsTable.getPlayerName(i)
+                      << std::setw(12) << statsTable.getTotalMatches(i)
+                      << std::setw(8) << statsTable.getWins(i)
+                      << statsTable.getLosses(i) << "\n";
         }
     }
+    long long totalMatches = statsTable.sumTotalMatches();
     
     std::cout << "\nTotal matches played across all players: " << totalMatches / 2 << "\n"; // Divide by 2 since each match involves 2 players
     std::cout << "=====================================\n";
@@ -230,32 +416,13 @@ void GameResultLogger::displayPlayerMatchCount() const {
 void GameResultLogger::displayPlayerWinRates() const {
     std::cout << "\n=== PLAYER WIN RATE ANALYSIS ===\n";
     
-    if (playerCount == 0) {
+    if (statsTable.getSize() == 0) {
         std::cout << "No player data available. Load results first.\n";
         return;
     }
     
-    // Create a sorted array for win rate ranking
-    PlayerStats sortedStats[MAX_PLAYERS];
-    int validPlayerCount = 0;
-    
-    // Copy players with match data
-    for (int i = 0; i < playerCount; ++i) {
-        if (playerStatistics[i].totalMatches > 0) {
-            sortedStats[validPlayerCount++] = playerStatistics[i];
-        }
-    }
-    
-    // Sort by win rate (descending)
-    for (int i = 0; i < validPlayerCount - 1; ++i) {
-        for (int j = 0; j < validPlayerCount - i - 1; ++j) {
-            if (sortedStats[j].winRate < sortedStats[j + 1].winRate) {
-                PlayerStats temp = sortedStats[j];
-                sortedStats[j] = sortedStats[j + 1];
-                sortedStats[j + 1] = temp;
-            }
-        }
-    }
+    // Players with match data, by win rate (descending)
+    DynamicArray<int> ranking = statsTable.rankByWinRate();
     
     std::cout << std::left;
     std::cout << std::setw(6) << "Rank" << std::setw(12) << "Player ID" 
@@ -263,14 +430,14 @@ void GameResultLogger::displayPlayerWinRates() const {
               << std::setw(10) << "Win Rate" << std::setw(12) << "Win Streak\n";  
     std::cout << std::string(72, '-') << "\n";
     
-    for (int i = 0; i < validPlayerCount; ++i) {
-        const PlayerStats& stats = sortedStats[i];
+    for (int i = 0; i < ranking.getSize(); ++i) {
+        int slot = ranking[i];
         std::cout << std::setw(6) << (i + 1)
-                  << std::setw(12) << stats.playerId
-                  << std::setw(20) << stats.playerName
-                  << std::setw(12) << stats.totalMatches
-                  << std::setw(9) << std::fixed << std::setprecision(1) << stats.winRate << "%"
-                  << stats.currentWinStreak << "\n";
+                  << std::setw(12) << statsTable.getPlayerId(slot)
+                  << std::setw(20) << statsTable.getPlayerName(slot)
+                  << std::setw(12) << statsTable.getTotalMatches(slot)
+                  << std::setw(9) << std::fixed << std::setprecision(1) << statsTable.getWinRate(slot) << "%"
+                  << statsTable.getCurrentWinStreak(slot) << "\n";
     }
     
     std::cout << "=================================\n";
@@ -279,7 +446,7 @@ void GameResultLogger::displayPlayerWinRates() const {
 void GameResultLogger::displayPlayerFavoriteChampions() const {
     std::cout << "\n=== PLAYER FAVORITE CHAMPIONS ===\n";
     
-    if (playerCount == 0) {
+    if (statsTable.getSize() == 0) {
         std::cout << "No player data available. Load results first.\n";
         return;
     }
@@ -289,38 +456,97 @@ void GameResultLogger::displayPlayerFavoriteChampions() const {
               << std::setw(20) << "Favorite Champion" << std::setw(8) << "Uses\n";
     std::cout << std::string(60, '-') << "\n";
     
-    for (int i = 0; i < playerCount; ++i) {
-        const PlayerStats& stats = playerStatistics[i];
-        if (stats.totalMatches > 0 && stats.mostUsedChampion != Champion::NoChampion) {
-            // Find usage count for most used champion
-            int maxUsage = 0;
-            for (int j = 0; j < 12; ++j) { // Only check valid champion enum range (0-11)
-                if (stats.championUsageCount[j] > maxUsage) {
-                    maxUsage = stats.championUsageCount[j];
-                }
-            }
-            
-            std::cout << std::setw(12) << stats.playerId
-                      << std::setw(20) << stats.playerName
-                      << std::setw(20) << championToString(stats.mostUsedChampion)
-                      << maxUsage << "\n";
+    for (int i = 0; i < statsTable.getSize(); ++i) {
+        Champion favorite = statsTable.getMostUsedChampion(i);
+        if (statsTable.getTotalMatches(i) > 0 && favorite != Champion::NoChampion) {
+            std::cout << std::setw(12) << statsTable.getPlayerId(i)
+                      << std::setw(20) << statsTable.getPlayerName(i)
+                      << std::setw(20) << toString(favorite)
+                      << statsTable.getChampionUsage(i, static_cast<int>(favorite)) << "\n";
         }
     }
     
     std::cout << "===================================\n";
 }
 
+void GameResultLogger::displayChampionStatistics(const std::string& championName) const {
+    Champion champion;
+    if (!ChampionAnalytics::parseChampion(championName, champion)) {
+        std::cout << "Unknown champion \"" << championName << "\". Champions: ";
+        for (int i = 0; i < ChampionAnalytics::CHAMPIONS; ++i) {
+            if (i > 0) std::cout << ", ";
+            std::cout << toString(static_cast<Champion>(i));
+        }
+        std::cout << "\n";
+        return;
+    }
+
+    std::cout << "\n=== STATISTICS FOR CHAMPION: " << toString(champion) << " ===\n";
+    int picks = championAnalytics.getPicks(champion);
+    if (picks == 0) {
+        std::cout << "No results with " << toString(champion) << " recorded.\n";
+        return;
+    }
+
+    std::cout << "Times Picked: " << picks << " (in " << championAnalytics.getResultCount() << " results)\n";
+    std::cout << "Wins: " << championAnalytics.getWins(champion) << " | Losses: " << championAnalytics.getLosses(champion) << "\n";
+    std::cout << "Win Rate: " << std::fixed << std::setprecision(1) << championAnalytics.getWinRate(champion) << "%\n";
+
+    // Matchups against every other champion
+    std::cout << "\n" << std::left;
+    std::cout << std::setw(14) << "Opponent" << std::setw(8) << "Games" << std::setw(8) << "Wins"
+              << std::setw(8) << "Losses" << "Win Rate\n";
+    std::cout << std::string(46, '-') << "\n";
+    for (int i = 0; i < ChampionAnalytics::CHAMPIONS; ++i) {
+        Champion opponent = static_cast<Champion>(i);
+        if (opponent == champion) continue;
+        int won = championAnalytics.getWins(champion, opponent);
+        int lost = championAnalytics.getWins(opponent, champion);
+        if (won + lost == 0) continue;
+
+        std::cout << std::setw(14) << toString(opponent)
+                  << std::setw(8) << (won + lost)
+                  << std::setw(8) << won
+                  << std::setw(8) << lost
+                  << std::fixed << std::setprecision(1) << (static_cast<float>(won) / (won + lost)) * 100.0f << "%\n";
+    }
+    int mirrors = championAnalytics.getWins(champion, champion);
+    if (mirrors > 0) {
+        std::cout << "Mirror matches: " << mirrors << "\n";
+    }
+
+    // Players who pick it most, from the per-player usage counts
+    DynamicArray<int> users;
+    int favoriteOf = 0;
+    for (int i = 0; i < statsTable.getSize(); ++i) {
+        if (statsTable.getChampionUsage(i, static_cast<int>(champion)) > 0) users.push_back(i);
+        if (statsTable.getMostUsedChampion(i) == champion) favoriteOf++;
+    }
+    std::stable_sort(users.begin(), users.end(), [this, champion](int a, int b) {
+        return statsTable.getChampionUsage(a, static_cast<int>(champion)) > statsTable.getChampionUsage(b, static_cast<int>(champion));
+    });
+
+    std::cout << "\nFavorite champion of " << favoriteOf << " player(s). Top players:\n";
+    for (int i = 0; i < users.getSize() && i < 5; ++i) {
+        int slot = users[i];
+        std::cout << "  " << std::setw(12) << statsTable.getPlayerId(slot)
+                  << std::setw(20) << statsTable.getPlayerName(slot)
+                  << statsTable.getChampionUsage(slot, static_cast<int>(champion)) << " games\n";
+    }
+    std::cout << "===================================\n";
+}
+
 void GameResultLogger::displayComprehensivePlayerStats() const {
     std::cout << "\n=== COMPREHENSIVE PLAYER STATISTICS ===\n";
     
-    if (playerCount == 0) {
+    if (statsTable.getSize() == 0) {
         std::cout << "No player data available. Load results first.\n";
         return;
     }
     
-    for (int i = 0; i < playerCount; ++i) {
-        const PlayerStats& stats = playerStatistics[i];
-        if (stats.totalMatches > 0) {
+    for (int i = 0; i < statsTable.getSize(); ++i) {
+        if (statsTable.getTotalMatches(i) > 0) {
+            PlayerStats stats = statsTable.get(i);
             std::cout << "\n--- " << stats.playerName << " (ID: " << stats.playerId << ") ---\n";
             std::cout << "Total Matches: " << stats.totalMatches << "\n";
             std::cout << "Wins: " << stats.wins << " | Losses: " << stats.losses << "\n";
@@ -329,17 +555,17 @@ void GameResultLogger::displayComprehensivePlayerStats() const {
             std::cout << "Longest Win Streak: " << stats.longestWinStreak << "\n";
             
             if (stats.mostUsedChampion != Champion::NoChampion) {
-                std::cout << "Most Used Champion: " << championToString(stats.mostUsedChampion) << "\n";
+                std::cout << "Most Used Champion: " << toString(stats.mostUsedChampion) << "\n";
             }
             
             // Show top 3 champions if available
             std::cout << "Champion Usage: ";
             int shownChampions = 0;
-            for (int j = 0; j < 12 && shownChampions < 3; ++j) { // Only check valid champion enum range (0-11)
+            for (int j = 0; j < PlayerStats::CHAMPION_SLOTS && shownChampions < 3; ++j) {
                 if (stats.championUsageCount[j] > 0) {
                     if (shownChampions > 0) std::cout << ", ";
                     Champion champ = static_cast<Champion>(j);
-                    std::cout << championToString(champ)
+                    std::cout << toString(champ)
                              << "(" << stats.championUsageCount[j] << ")";
                     shownChampions++;
                 }
@@ -357,10 +583,8 @@ void GameResultLogger::displayComprehensivePlayerStats() const {
 
 // Stack operations for search results
 void GameResultLogger::pushSearchResult(const Result& result) {
-    if (!searchResultsStack.isFull()) {
-        searchResultsStack.push(result);
-        recordOperation("Pushed search result to stack - Match ID: " + result.matchId);
-    }
+    searchResultsStack.push(result);
+    recordOperation("Pushed search result to stack - Match ID: " + result.matchId);
 }
 
 Result GameResultLogger::popSearchResult() {
@@ -373,9 +597,7 @@ Result GameResultLogger::popSearchResult() {
 }
 
 void GameResultLogger::clearSearchResults() {
-    while (!searchResultsStack.isEmpty()) {
-        searchResultsStack.pop();
-    }
+    searchResultsStack.clear();
     recordOperation("Cleared all search results from stack");
 }
 
@@ -402,10 +624,8 @@ void GameResultLogger::displaySearchResultsStack() const {
 
 // Stack operations for player analysis
 void GameResultLogger::pushPlayerAnalysis(const PlayerStats& stats) {
-    if (!playerAnalysisStack.isFull()) {
-        playerAnalysisStack.push(stats);
-        recordOperation("Pushed player analysis to stack - Player ID: " + stats.playerId);
-    }
+    playerAnalysisStack.push(stats);
+    recordOperation("Pushed player analysis to stack - Player ID: " + stats.playerId);
 }
 
 PlayerStats GameResultLogger::popPlayerAnalysis() {
@@ -455,9 +675,9 @@ void GameResultLogger::displayPlayerAnalysisStack() const {
 
 // Operation history stack management
 void GameResultLogger::recordOperation(const std::string& operation) {
-    if (!operationHistoryStack.isFull()) {
-        operationHistoryStack.push(operation);
-    }
+    // Bounded stack: the oldest entry is discarded once 100 are held
+    operationHistoryStack.push(operation);
+    operationLog.append(operation);
 }
 
 std::string GameResultLogger::getLastOperation() {
@@ -478,12 +698,17 @@ void GameResultLogger::displayOperationHistory() const {
     
     std::cout << "Recent operations are stored in stack (LIFO order)\n";
     std::cout << "Use getLastOperation() to retrieve last operation\n";
+
+    // Newest first from the audit log, which is not consumed by reading
+    std::cout << "\nLast operations logged (" << operationLog.getTotalAppended() << " total):\n";
+    int shown = 0;
+    for (auto it = operationLog.rbegin(); it != operationLog.rend() && shown < 10; ++it, ++shown) {
+        std::cout << "  " << *it << "\n";
+    }
 }
 
 void GameResultLogger::clearOperationHistory() {
-    while (!operationHistoryStack.isEmpty()) {
-        operationHistoryStack.pop();
-    }
+    operationHistoryStack.clear();
     recordOperation("Operation history cleared");
 }
 
@@ -494,11 +719,8 @@ void GameResultLogger::clearOperationHistory() {
 void GameResultLogger::traverseResultsForward() const {
     std::cout << "\n=== FORWARD TRAVERSAL OF RESULTS (via JsonLoader) ===\n";
     
-    // Get fresh data from JsonLoader (DoublyLinkedList handled internally)
-    auto resultsList = JsonLoader::loadResults("data/results.json");
-    if (resultsList.getSize() == 0) {
-        resultsList = JsonLoader::loadResults("data/results.json");
-    }
+    // Resident results, re-read only when results.json changed on disk
+    const ChunkedLog<Result>& resultsList = resultStore.current();
     
     if (resultsList.getSize() == 0) {
         std::cout << "No results in JsonLoader DoublyLinkedList to traverse.\n";
@@ -507,23 +729,18 @@ void GameResultLogger::traverseResultsForward() const {
     
     std::cout << "Traversing " << resultsList.getSize() << " results forward:\n";
     
-    for (int i = 0; i < resultsList.getSize(); ++i) {
-        Result* result = resultsList.get(i);
-        if (result) {
-            std::cout << "Result " << (i+1) << ": Match ID " << result->matchId 
-                      << ", Winner ID: " << result->winnerId << "\n";
-        }
+    int position = 1;
+    for (const Result& result : resultsList) {
+        std::cout << "Result " << position++ << ": Match ID " << result.matchId 
+                  << ", Winner ID: " << result.winnerId << "\n";
     }
 }
 
 void GameResultLogger::traverseResultsBackward() const {
     std::cout << "\n=== BACKWARD TRAVERSAL OF RESULTS (via JsonLoader) ===\n";
     
-    // Get fresh data from JsonLoader (DoublyLinkedList handled internally)
-    auto resultsList = JsonLoader::loadResults("data/results.json");
-    if (resultsList.getSize() == 0) {
-        resultsList = JsonLoader::loadResults("data/results.json");
-    }
+    // Resident results, re-read only when results.json changed on disk
+    const ChunkedLog<Result>& resultsList = resultStore.current();
     
     if (resultsList.getSize() == 0) {
         std::cout << "No results in JsonLoader DoublyLinkedList to traverse.\n";
@@ -532,41 +749,27 @@ void GameResultLogger::traverseResultsBackward() const {
     
     std::cout << "Traversing " << resultsList.getSize() << " results backward:\n";
     
-    for (int i = resultsList.getSize() - 1; i >= 0; --i) {
-        Result* result = resultsList.get(i);
-        if (result) {
-            std::cout << "Result " << (i+1) << ": Match ID " << result->matchId 
-                      << ", Winner ID: " << result->winnerId << "\n";
-        }
+    int position = resultsList.getSize();
+    for (auto it = resultsList.rbegin(); it != resultsList.rend(); ++it) {
+        std::cout << "Result " << position-- << ": Match ID " << it->matchId 
+                  << ", Winner ID: " << it->winnerId << "\n";
     }
 }
 
 void GameResultLogger::findResultInList(const std::string& matchId) const {
     std::cout << "\n=== SEARCHING FOR MATCH ID " << matchId << " IN JSONLOADER RESULTS ===\n";
     
-    // Get fresh data from JsonLoader (DoublyLinkedList handled internally)
-    auto resultsList = JsonLoader::loadResults("data/results.json");
-    if (resultsList.getSize() == 0) {
-        resultsList = JsonLoader::loadResults("data/results.json");
-    }
-    
-    bool found = false;
-    for (int i = 0; i < resultsList.getSize(); ++i) {
-        Result* result = resultsList.get(i);
-        if (result && result->matchId == matchId) {
-            std::cout << "Found at position " << (i+1) << ":\n";
-            std::cout << "  Match ID: " << result->matchId << "\n";
-            std::cout << "  Winner ID: " << result->winnerId << "\n";
-            
-            // Push to search results stack
-            const_cast<GameResultLogger*>(this)->pushSearchResult(*result);
-            
-            found = true;
-            break;
-        }
-    }
-    
-    if (!found) {
+    // Resident results, indexed by match ID
+    int index = resultStore.indexOfMatchId(matchId);
+    if (index != -1) {
+        const Result& result = resultStore.current()[index];
+        std::cout << "Found at position " << index + 1 << ":\n";
+        std::cout << "  Match ID: " << result.matchId << "\n";
+        std::cout << "  Winner ID: " << result.winnerId << "\n";
+        
+        // Push to search results stack
+        const_cast<GameResultLogger*>(this)->pushSearchResult(result);
+    } else {
         std::cout << "Match ID " << matchId << " not found in JsonLoader results.\n";
     }
 }
@@ -574,27 +777,17 @@ void GameResultLogger::findResultInList(const std::string& matchId) const {
 void GameResultLogger::filterResultsByPlayer(const std::string& playerId) const {
     std::cout << "\n=== FILTERING RESULTS BY PLAYER " << playerId << " (via JsonLoader) ===\n";
     
-    // Get fresh data from JsonLoader (DoublyLinkedList handled internally)
-    auto resultsList = JsonLoader::loadResults("data/results.json");
-    if (resultsList.getSize() == 0) {
-        resultsList = JsonLoader::loadResults("data/results.json");
-    }
-    
-    int foundCount = 0;
+    // Resident results, indexed by winner ID
+    DynamicArray<const Result*> won = resultStore.findByWinner(playerId);
+    int foundCount = won.getSize();
     
-    for (int i = 0; i < resultsList.getSize(); ++i) {
-        Result* result = resultsList.get(i);
+    for (const Result* result : won) {
+        std::cout << "Match " << result->matchId << ": ";
+        std::cout << "Player " << playerId << " WON";
+        std::cout << " (Winner ID: " << result->winnerId << ")\n";
         
-        if (result && result->winnerId == playerId) {
-            std::cout << "Match " << result->matchId << ": ";
-            std::cout << "Player " << playerId << " WON";
-            std::cout << " (Winner ID: " << result->winnerId << ")\n";
-            
-            // Push to search results stack
-            const_cast<GameResultLogger*>(this)->pushSearchResult(*result);
-            
-            foundCount++;
-        }
+        // Push to search results stack
+        const_cast<GameResultLogger*>(this)->pushSearchResult(*result);
     }
     
     if (foundCount == 0) {
@@ -612,52 +805,48 @@ int GameResultLogger::getLoadedResultsCount() const {
 void GameResultLogger::searchMatchesByPlayer(const std::string& playerId) const {
     std::cout << "\n=== SEARCHING FOR PLAYER " << playerId << " ===\n";
     
-    bool found = false;
-    int matchCount = 0;
+    // Positions of every result whose match lists the player
+    const DynamicArray<int>& positions = resultJoin.resultsOfPlayer(playerId);
     
-    // Use get() method to traverse the DoublyLinkedList
-    for (int i = 0; i < loadedResultsCount; i++) {
-        Result* resultPtr = nullptr;
-        if (!resultPtr) continue;
-        
-        const Result& result = *resultPtr;
-        
-        // Check if this result involves the player (using MatchPlayerInfo list)
-        for (int j = 0; j < 0; j++) {
-            MatchPlayerInfo* playerInfo = nullptr;
-            if (playerInfo && playerInfo->matchId == result.matchId) {
-                if (playerInfo->player1Id == playerId || playerInfo->player2Id == playerId) {
-                    found = true;
-                    matchCount++;
-                    
-                    std::cout << "Match " << matchCount << ":\n";
-                    std::cout << "  Match ID: " << result.matchId << "\n";
-                    std::cout << "  Winner ID: " << result.winnerId << "\n";
-                    std::cout << "  Player 1 Champion: " << championToString(result.championsP1) << "\n";
-                    std::cout << "  Player 2 Champion: " << championToString(result.championsP2) << "\n\n";
-                }
-                break;
-            }
-        }
+    int matchCount = 0;
+    for (int position : positions) {
+        std::cout << "Match " << ++matchCount << ":\n";
+        displayJoinedRow(resultJoin.row(position));
+        std::cout << "\n";
     }
     
-    if (!found) {
+    if (matchCount == 0) {
         std::cout << "No matches found for Player " << playerId << "\n";
     } else {
         std::cout << "Total matches found: " << matchCount << "\n";
     }
 }
 
+// Result with its match details and player names
+void GameResultLogger::displayJoinedRow(const JoinedRow& row) const {
+    const Result& result = *row.result;
+    std::cout << "  Match ID: " << result.matchId << "\n";
+    if (row.match) {
+        std::cout << "  Tournament: " << row.match->tournamentId << " (" << toString(row.match->stage) << ")\n";
+        std::cout << "  Date: " << row.match->date << " " << row.match->time << "\n";
+        std::cout << "  Player 1: " << (row.player1 ? row.player1->name : "Unknown") << " (ID: " << row.match->player1 << ")\n";
+        std::cout << "  Player 2: " << (row.player2 ? row.player2->name : "Unknown") << " (ID: " << row.match->player2 << ")\n";
+    }
+    std::cout << "  Winner ID: " << result.winnerId << "\n";
+    std::cout << "  Player 1 Champion: " << toString(result.championsP1) << "\n";
+    std::cout << "  Player 2 Champion: " << toString(result.championsP2) << "\n";
+}
+
 void GameResultLogger::displayPlayerPerformance(const std::string& playerId) const {
     std::cout << "\n=== PLAYER " << playerId << " PERFORMANCE ===\n";
     
     int playerIndex = findPlayerIndex(playerId);
-    if (playerIndex == -1 || playerStatistics[playerIndex].totalMatches == 0) {
+    if (playerIndex == -1 || statsTable.getTotalMatches(playerIndex) == 0) {
         std::cout << "No performance data available for Player " << playerId << "\n";
         return;
     }
     
-    const PlayerStats& stats = playerStatistics[playerIndex];
+    PlayerStats stats = statsTable.get(playerIndex);
     std::cout << "Player ID: " << stats.playerId << "\n";
     std::cout << "Player Name: " << stats.playerName << "\n";
     std::cout << "Total Matches: " << stats.totalMatches << "\n";
@@ -669,35 +858,33 @@ void GameResultLogger::displayPlayerPerformance(const std::string& playerId) con
     std::cout << "Average Game Duration: " << std::fixed << std::setprecision(1) << stats.averageGameDuration << " minutes\n";
     
     if (stats.mostUsedChampion != Champion::NoChampion) {
-        std::cout << "Most Used Champion: " << championToString(stats.mostUsedChampion) << "\n";
+        std::cout << "Most Used Champion: " << toString(stats.mostUsedChampion) << "\n";
     }
 }
 
 void GameResultLogger::searchMatchesByMatchId(const std::string& matchId) const {
     std::cout << "\n=== SEARCHING FOR MATCH " << matchId << " ===\n";
     
-    bool found = false;
-    
-    // Use get() method to traverse the DoublyLinkedList
-    for (int i = 0; i < loadedResultsCount; i++) {
-        Result* resultPtr = nullptr;
-        if (!resultPtr) continue;
-        
-        const Result& result = *resultPtr;
-        if (result.matchId == matchId) {
-            found = true;
-            
-            std::cout << "Match Found:\n";
-            std::cout << "  Match ID: " << result.matchId << "\n";
-            std::cout << "  Winner ID: " << result.winnerId << "\n";
-            std::cout << "  Player 1 Champion: " << championToString(result.championsP1) << "\n";
-            std::cout << "  Player 2 Champion: " << championToString(result.championsP2) << "\n";
-            break;
-        }
+    // Join first: a reload while syncing would invalidate the result pointer
+    resultJoin.sync();
+    const Result* result = resultStore.findByMatchId(matchId);
+    if (result) {
+        std::cout << "Match Found:\n";
+        displayJoinedRow(resultJoin.join(*result));
+        return;
     }
     
-    if (!found) {
+    // Not a match ID; try it as a tournament ID
+    const DynamicArray<int>& positions = resultJoin.resultsOfTournament(matchId);
+    if (positions.empty()) {
         std::cout << "No match found with ID " << matchId << "\n";
+        return;
+    }
+    
+    std::cout << "Tournament " << matchId << ": " << positions.getSize() << " results\n";
+    for (int position : positions) {
+        std::cout << "\n";
+        displayJoinedRow(resultJoin.row(position));
     }
 }
 
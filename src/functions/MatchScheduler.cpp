@@ -4,25 +4,20 @@
 #include <iostream>
 #include <iomanip>
 #include <sstream>
+#include <utility>
 
 int MatchScheduler::nextMatchIdCounter = 1;
 
 // Load dummy check in players from JSON file
 DynamicArray<Player> MatchScheduler::loadPlayersFromFile() {
-    PriorityQueue<Player> checkedInPlayers;
+    CheckInQueue checkedInPlayers;
     try {
         checkedInPlayers = JsonLoader::loadCheckedInPlayers(filename);
         std::cout << "Loaded " << checkedInPlayers.getSize() << " players from file.\n";
     } catch (const std::exception& e) {
         std::cerr << "Error loading players: " << e.what() << std::endl;
     }
-    DynamicArray<Player> checkedInPlayersArray;
-    int size = checkedInPlayers.getSize();
-    for (int i = 0; i < size; ++i) {
-        Player player = checkedInPlayers.dequeue();
-        checkedInPlayersArray.push_back(player);
-    }
-    return checkedInPlayersArray;
+    return checkedInPlayers.drainSorted();
 }
 
 DynamicArray<Match> MatchScheduler::scheduleQualifierMatches(const DynamicArray<Player>& players, const std::string& tournamentId) {
@@ -59,9 +54,7 @@ DynamicArray<Match> MatchScheduler::scheduleQualifierMatches(const DynamicArray<
         );
         
         // Add group matches to overall matches
-        for (int i = 0; i < groupMatches.getSize(); ++i) {
-            matches.push_back(groupMatches[i]);
-        }
+        matches.append(std::move(groupMatches));
     }
     
     std::cout << "Scheduled " << matches.getSize() << " qualifier matches across " 
@@ -73,13 +66,13 @@ DynamicArray<Match> MatchScheduler::scheduleStageMatches(const DynamicArray<Play
     DynamicArray<Match> matches;
     
     if (players.empty()) {
-        std::cout << "No players available for " << stageToString(stage) << " matches.\n";
+        std::cout << "No players available for " << toString(stage) << " matches.\n";
         return matches;
     }
     
     if (players.getSize() % 2 != 0) {
         std::cout << "Warning: Odd number of players (" << players.getSize() 
-                  << ") for " << stageToString(stage) << ". One player will receive a bye.\n";
+                  << ") for " << toString(stage) << ". One player will receive a bye.\n";
     }
     
     // After qualifiers, use random pairing
@@ -90,10 +83,10 @@ DynamicArray<Match> MatchScheduler::scheduleStageMatches(const DynamicArray<Play
     for (int i = 0; i < pairs.getSize(); ++i) {
         Match match = createMatch(getNextMatchId(), tournamentId, stage, 
                                 pairs[i].first, pairs[i].second, currentDate, "14:00");
-        matches.push_back(match);
+        matches.push_back(std::move(match));
     }
     
-    std::cout << "Scheduled " << matches.getSize() << " " << stageToString(stage) << " matches.\n";
+    std::cout << "Scheduled " << matches.getSize() << " " << toString(stage) << " matches.\n";
     return matches;
 }
 
@@ -105,9 +98,7 @@ DynamicArray<PlayerPair> MatchScheduler::pairPlayersByPoints(const DynamicArray<
     for (int i = 0; i < availablePlayers.getSize() - 1; ++i) {
         for (int j = 0; j < availablePlayers.getSize() - i - 1; ++j) {
             if (availablePlayers[j].points < availablePlayers[j + 1].points) {
-                Player temp = availablePlayers[j];
-                availablePlayers[j] = availablePlayers[j + 1];
-                availablePlayers[j + 1] = temp;
+                std::swap(availablePlayers[j], availablePlayers[j + 1]);
             }
         }
     }
@@ -124,7 +115,7 @@ DynamicArray<PlayerPair> MatchScheduler::pairPlayersByPoints(const DynamicArray<
     
     // First, pair regular players with each other
     for (int i = 0; i < regularPlayers.getSize() - 1; i += 2) {
-        pairs.push_back(PlayerPair(regularPlayers[i], regularPlayers[i + 1]));
+        pairs.emplace_back(regularPlayers[i], regularPlayers[i + 1]);
     }
     
     // Then pair early birds with remaining regular players
@@ -132,7 +123,7 @@ DynamicArray<PlayerPair> MatchScheduler::pairPlayersByPoints(const DynamicArray<
     int earlyBirdIndex = 0;
     
     while (earlyBirdIndex < earlyBirds.getSize() && regularIndex < regularPlayers.getSize()) {
-        pairs.push_back(PlayerPair(earlyBirds[earlyBirdIndex], regularPlayers[regularIndex]));
+        pairs.emplace_back(earlyBirds[earlyBirdIndex], regularPlayers[regularIndex]);
         earlyBirdIndex++;
         regularIndex++;
     }
@@ -144,7 +135,7 @@ DynamicArray<PlayerPair> MatchScheduler::pairPlayersByPoints(const DynamicArray<
         std::cout << "Some early birds will be paired together, violating the early bird protection rule.\n";
         
         for (int i = earlyBirdIndex; i < earlyBirds.getSize() - 1; i += 2) {
-            pairs.push_back(PlayerPair(earlyBirds[i], earlyBirds[i + 1]));
+            pairs.emplace_back(earlyBirds[i], earlyBirds[i + 1]);
         }
     }
     
@@ -163,14 +154,12 @@ DynamicArray<PlayerPair> MatchScheduler::randomPairing(const DynamicArray<Player
         std::uniform_int_distribution<int> dis(0, i);
         int j = dis(g);
         
-        Player temp = shuffledPlayers[i];
-        shuffledPlayers[i] = shuffledPlayers[j];
-        shuffledPlayers[j] = temp;
+        std::swap(shuffledPlayers[i], shuffledPlayers[j]);
     }
     
     // Create pairs
     for (int i = 0; i < shuffledPlayers.getSize() - 1; i += 2) {
-        pairs.push_back(PlayerPair(shuffledPlayers[i], shuffledPlayers[i + 1]));
+        pairs.emplace_back(shuffledPlayers[i], shuffledPlayers[i + 1]);
     }
     
     return pairs;
@@ -228,7 +217,7 @@ Match MatchScheduler::createMatch(const std::string& matchId, const std::string&
 }
 
 void MatchScheduler::displayMatchesByStage(const DynamicArray<Match>& matches, TournamentStage stage) {
-    std::cout << "\n=== " << stageToString(stage) << " MATCHES ===\n";
+    std::cout << "\n=== " << toString(stage) << " MATCHES ===\n";
     
     bool hasMatches = false;
     for (int i = 0; i < matches.getSize(); ++i) {
@@ -264,19 +253,6 @@ void MatchScheduler::displayTournamentBracket(const DynamicArray<Match>& matches
     }
 }
 
-std::string MatchScheduler::stageToString(TournamentStage stage) {
-    switch (stage) {
-        case TournamentStage::Registration: return "Registration";
-        case TournamentStage::Qualifiers: return "Qualifiers";
-        case TournamentStage::Tiebreakers: return "Tiebreakers";
-        case TournamentStage::Quarterfinals: return "Quarterfinals";
-        case TournamentStage::Semifinals: return "Semifinals";
-        case TournamentStage::Finals: return "Finals";
-        case TournamentStage::Completed: return "Completed";
-        default: return "Unknown Stage";
-    }
-}
-
 std::string MatchScheduler::formatDateTime() {
     auto now = std::chrono::system_clock::now();
     auto time_t = std::chrono::system_clock::to_time_t(now);
@@ -299,7 +275,7 @@ DynamicArray<DynamicArray<Player>> MatchScheduler::createGroupsByPoints(const Dy
     
     // Initialize groups
     for (int i = 0; i < numGroups; ++i) {
-        groups.push_back(DynamicArray<Player>());
+        groups.emplace_back();
     }
     
     // Sort players by points (descending order)
@@ -307,9 +283,7 @@ DynamicArray<DynamicArray<Player>> MatchScheduler::createGroupsByPoints(const Dy
     for (int i = 0; i < sortedPlayers.getSize() - 1; ++i) {
         for (int j = 0; j < sortedPlayers.getSize() - i - 1; ++j) {
             if (sortedPlayers[j].points < sortedPlayers[j + 1].points) {
-                Player temp = sortedPlayers[j];
-                sortedPlayers[j] = sortedPlayers[j + 1];
-                sortedPlayers[j + 1] = temp;
+                std::swap(sortedPlayers[j], sortedPlayers[j + 1]);
             }
         }
     }
@@ -320,7 +294,7 @@ DynamicArray<DynamicArray<Player>> MatchScheduler::createGroupsByPoints(const Dy
         int groupIndex = (i / numGroups) % 2 == 0 ? 
                         (i % numGroups) : 
                         (numGroups - 1 - (i % numGroups));
-        groups[groupIndex].push_back(sortedPlayers[i]);
+        groups[groupIndex].push_back(std::move(sortedPlayers[i]));
     }
     
     // Display group composition
@@ -349,7 +323,7 @@ DynamicArray<Match> MatchScheduler::scheduleRoundRobinMatches(const DynamicArray
                                     groupPlayers[i], groupPlayers[j], date, "TBD");
             
             // Add group identifier to match (we can use a comment or extend Match structure)
-            matches.push_back(match);
+            matches.push_back(std::move(match));
             
             std::cout << "  " << matchId << ": " << groupPlayers[i].name 
                       << " vs " << groupPlayers[j].name << "\n";
@@ -387,7 +361,7 @@ DynamicArray<Match> MatchScheduler::scheduleTiebreakerMatches(const DynamicArray
         std::string matchId = getNextMatchId();
         Match match = createMatch(matchId, tournamentId, TournamentStage::Tiebreakers,
                                 tiedPlayers[0], tiedPlayers[1], date, "TBD");
-        tiebreakerMatches.push_back(match);
+        tiebreakerMatches.push_back(std::move(match));
         
         std::cout << "  Tiebreaker " << matchId << ": " << tiedPlayers[0].name 
                   << " vs " << tiedPlayers[1].name << "\n";
@@ -398,7 +372,7 @@ DynamicArray<Match> MatchScheduler::scheduleTiebreakerMatches(const DynamicArray
                 std::string matchId = getNextMatchId();
                 Match match = createMatch(matchId, tournamentId, TournamentStage::Tiebreakers,
                                         tiedPlayers[i], tiedPlayers[j], date, "TBD");
-                tiebreakerMatches.push_back(match);
+                tiebreakerMatches.push_back(std::move(match));
                 
                 std::cout << "  Tiebreaker " << matchId << ": " << tiedPlayers[i].name 
                           << " vs " << tiedPlayers[j].name << "\n";
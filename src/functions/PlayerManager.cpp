@@ -6,8 +6,31 @@
 PlayerManager::PlayerManager() : dataLoaded(false) {}
 
 bool PlayerManager::PlayerManager::loadPlayersFromFile() {
+    playersWatch.invalidate();
+    return refreshFromFile();
+}
+
+bool PlayerManager::refreshFromFile() {
+    if (!dataLoaded) playersWatch.invalidate();
     try {
-        allPlayers = JsonLoader::loadPlayers(filename);
+        FileWatch::Change change = playersWatch.check();
+        if (change == FileWatch::Change::None) return true;
+
+        std::uintmax_t journalOffset = playersWatch.getJournalOffset();
+        if (change == FileWatch::Change::Appended) {
+            DoublyLinkedList<Player> appended = JsonLoader::loadAppendedPlayers(filename, journalOffset);
+            for (Player& player : appended) {
+                // Our own addPlayer() appends are already in memory
+                if (playersById.contains(player.id)) continue;
+                allPlayers.append(std::move(player));
+                auto tail = --allPlayers.end();
+                playersById.insert(tail->id, tail);
+            }
+        } else {
+            allPlayers = JsonLoader::loadPlayers(filename, &journalOffset);
+            rebuildIndex();
+        }
+        playersWatch.loaded(journalOffset);
         dataLoaded = true;
         return true;
     } catch (const std::exception& e) {
@@ -17,6 +40,17 @@ bool PlayerManager::PlayerManager::loadPlayersFromFile() {
     }
 }
 
+void PlayerManager::rebuildIndex() {
+    playersById.clear();
+    playersById.reserve(allPlayers.getSize());
+    for (auto it = allPlayers.begin(); it != allPlayers.end(); ++it) {
+        // First occurrence wins, as the old front-to-back scan did
+        if (!playersById.contains(it->id)) {
+            playersById.insert(it->id, it);
+        }
+    }
+}
+
 Player* PlayerManager::findPlayerById(const std::string& playerId) {
     if (!dataLoaded) {
         if (!loadPlayersFromFile()) {
@@ -25,13 +59,11 @@ Player* PlayerManager::findPlayerById(const std::string& playerId) {
         }
     }
     
-    // Search through all loaded players
-    for (int i = 0; i < allPlayers.getSize(); i++) {
-        Player* currentPlayer = allPlayers.get(i);
-        if (currentPlayer && currentPlayer->id == playerId) {
-            std::cout << "Player found in database: " << currentPlayer->name << " (ID: " << playerId << ")" << std::endl;
-            return currentPlayer;
-        }
+    auto* found = playersById.find(playerId);
+    if (found) {
+        Player& currentPlayer = **found;
+        std::cout << "Player found in database: " << currentPlayer.name << " (ID: " << playerId << ")" << std::endl;
+        return &currentPlayer;
     }
     
     std::cout << "Player with ID " << playerId << " not found in database." << std::endl;
@@ -53,12 +85,9 @@ void PlayerManager::displayAllPlayers() const {
     }
     
     std::cout << "\n=== ALL PLAYERS IN DATABASE ===" << std::endl;
-    for (int i = 0; i < allPlayers.getSize(); i++) {
-        Player* player = allPlayers.get(i);
-        if (player) {
-            std::cout << "ID: " << player->id << ", Name: " << player->name 
-                      << ", Email: " << player->email << ", Date Joined: " << player->dateJoined << std::endl;
-        }
+    for (const Player& player : allPlayers) {
+        std::cout << "ID: " << player.id << ", Name: " << player.name 
+                  << ", Email: " << player.email << ", Date Joined: " << player.dateJoined << std::endl;
     }
     std::cout << "Total players in database: " << allPlayers.getSize() << std::endl;
 }
@@ -78,6 +107,7 @@ bool PlayerManager::addPlayer(const Player& player) {
     }
 
     allPlayers.append(player);
+    playersById.insert(player.id, --allPlayers.end());
 
     // Save changes to file
     if (!JsonWriter::appendPlayer(player, filename)) {
@@ -97,27 +127,24 @@ void PlayerManager::deletePlayer(const std::string& playerId) {
         }
     }
 
-    for (int i = 0; i < allPlayers.getSize(); i++) {
-        Player* currentPlayer = allPlayers.get(i);
-        if (currentPlayer && currentPlayer->id == playerId) {
-            allPlayers.removeAt(i);
-            std::cout << "Player with ID " << playerId << " has been deleted." << std::endl;
-            return;
-        }
+    auto* found = playersById.find(playerId);
+    if (!found) {
+        std::cout << "Player with ID " << playerId << " not found in database." << std::endl;
+        return;
     }
 
+    allPlayers.erase(*found);
+    playersById.erase(playerId);
+    std::cout << "Player with ID " << playerId << " has been deleted." << std::endl;
+
     // Save changes to file
     if (JsonWriter::writeAllPlayers(allPlayers, filename)) {
         std::cout << "Player database updated successfully." << std::endl;
     } else {
         std::cout << "Failed to update player database." << std::endl;
     }
-    
-    std::cout << "Player with ID " << playerId << " not found in database." << std::endl;
 }
 
 void PlayerManager::reloadData() {
-    dataLoaded = false;
-    allPlayers.clear();
-    loadPlayersFromFile();
+    refreshFromFile();
 }
@@ -0,0 +1,172 @@
+#include "functions/PlayerStatsTable.hpp"
+#include <algorithm>
+
+int PlayerStatsTable::getSize() const {
+    return ids.getSize();
+}
+
+void PlayerStatsTable::reserve(int players) {
+    slotById.reserve(players);
+    matches.reserve(players);
+    winCounts.reserve(players);
+    lossCounts.reserve(players);
+    streaks.reserve(players);
+    longestStreaks.reserve(players);
+    ids.reserve(players);
+    names.reserve(players);
+    favourites.reserve(players);
+    usage.reserve(players * PlayerStats::CHAMPION_SLOTS);
+    lastDates.reserve(players);
+    durations.reserve(players);
+}
+
+void PlayerStatsTable::clear() {
+    slotById.clear();
+    matches.clear();
+    winCounts.clear();
+    lossCounts.clear();
+    streaks.clear();
+    longestStreaks.clear();
+    ids.clear();
+    names.clear();
+    favourites.clear();
+    usage.clear();
+    lastDates.clear();
+    durations.clear();
+}
+
+int PlayerStatsTable::find(const std::string& playerId) const {
+    const int* slot = slotById.find(playerId);
+    return slot ? *slot : -1;
+}
+
+int PlayerStatsTable::findOrAdd(const std::string& playerId, const std::string& playerName) {
+    int slot = find(playerId);
+    if (slot != -1) return slot;
+
+    slot = ids.getSize();
+    slotById.insert(playerId, slot);
+    matches.push_back(0);
+    winCounts.push_back(0);
+    lossCounts.push_back(0);
+    streaks.push_back(0);
+    longestStreaks.push_back(0);
+    ids.push_back(playerId);
+    names.push_back(playerName);
+    favourites.push_back(Champion::NoChampion);
+    for (int i = 0; i < PlayerStats::CHAMPION_SLOTS; ++i) {
+        usage.push_back(0);
+    }
+    lastDates.push_back("");
+    durations.push_back(0.0f);
+    return slot;
+}
+
+void PlayerStatsTable::recordMatch(int slot, bool isWin, Champion champion, const std::string& matchDate, float gameDuration) {
+    int total = ++matches[slot];
+    if (isWin) {
+        winCounts[slot]++;
+        if (++streaks[slot] > longestStreaks[slot]) {
+            longestStreaks[slot] = streaks[slot];
+        }
+    } else {
+        lossCounts[slot]++;
+        streaks[slot] = 0;
+    }
+
+    // Update champion usage
+    int championIndex = static_cast<int>(champion);
+    if (champion != Champion::NoChampion && championIndex >= 0 && championIndex < PlayerStats::CHAMPION_SLOTS) {
+        int* counts = usage.begin() + slot * PlayerStats::CHAMPION_SLOTS;
+        int used = ++counts[championIndex];
+
+        // Most used champion: the first one with the highest count. Only
+        // this champion's count changed, so it either takes over or the
+        // favourite stands; no rescan.
+        int favourite = static_cast<int>(favourites[slot]);
+        if (favourite == static_cast<int>(Champion::NoChampion) || used > counts[favourite] ||
+            (used == counts[favourite] && championIndex < favourite)) {
+            favourites[slot] = champion;
+        }
+    }
+
+    lastDates[slot] = matchDate;
+
+    // Update average game duration
+    float& average = durations[slot];
+    average = total > 1 ? ((average * (total - 1)) + gameDuration) / total : gameDuration;
+}
+
+PlayerStats PlayerStatsTable::get(int slot) const {
+    PlayerStats stats(ids[slot], names[slot]);
+    stats.totalMatches = matches[slot];
+    stats.wins = winCounts[slot];
+    stats.losses = lossCounts[slot];
+    stats.winRate = getWinRate(slot);
+    stats.mostUsedChampion = favourites[slot];
+    for (int i = 0; i < PlayerStats::CHAMPION_SLOTS; ++i) {
+        stats.championUsageCount[i] = getChampionUsage(slot, i);
+    }
+    stats.lastMatchDate = lastDates[slot];
+    stats.currentWinStreak = streaks[slot];
+    stats.longestWinStreak = longestStreaks[slot];
+    stats.averageGameDuration = durations[slot];
+    return stats;
+}
+
+void PlayerStatsTable::set(int slot, const PlayerStats& stats) {
+    if (ids[slot] != stats.playerId) {
+        slotById.erase(ids[slot]);
+        slotById.insert(stats.playerId, slot);
+        ids[slot] = stats.playerId;
+    }
+    names[slot] = stats.playerName;
+    matches[slot] = stats.totalMatches;
+    winCounts[slot] = stats.wins;
+    lossCounts[slot] = stats.losses;
+    // The favourite is derived from the counts rather than trusted, so
+    // recordMatch() can keep it up to date from here on
+    int maxUsage = 0;
+    favourites[slot] = Champion::NoChampion;
+    for (int i = 0; i < PlayerStats::CHAMPION_SLOTS; ++i) {
+        int count = stats.championUsageCount[i];
+        usage[slot * PlayerStats::CHAMPION_SLOTS + i] = count;
+        if (count > maxUsage && i != static_cast<int>(Champion::NoChampion)) {
+            maxUsage = count;
+            favourites[slot] = static_cast<Champion>(i);
+        }
+    }
+    lastDates[slot] = stats.lastMatchDate;
+    streaks[slot] = stats.currentWinStreak;
+    longestStreaks[slot] = stats.longestWinStreak;
+    durations[slot] = stats.averageGameDuration;
+}
+
+DynamicArray<int> PlayerStatsTable::rankByWinRate() const {
+    int count = getSize();
+    const int* played = matches.begin();
+    const int* won = winCounts.begin();
+
+    // Rates for every slot in one branch-free pass over two columns
+    DynamicArray<float> rates(count);
+    for (int slot = 0; slot < count; ++slot) {
+        rates.push_back(winRateOf(won[slot], played[slot]));
+    }
+
+    DynamicArray<int> ranked(count);
+    for (int slot = 0; slot < count; ++slot) {
+        if (played[slot] > 0) ranked.push_back(slot);
+    }
+    const float* rate = rates.begin();
+    std::stable_sort(ranked.begin(), ranked.end(), [rate](int a, int b) { return rate[a] > rate[b]; });
+    return ranked;
+}
+
+long long PlayerStatsTable::sumTotalMatches() const {
+    long long total = 0;
+    const int* played = matches.begin();
+    for (int slot = 0; slot < getSize(); ++slot) {
+        total += played[slot];
+    }
+    return total;
+}
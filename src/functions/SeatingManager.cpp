@@ -29,7 +29,8 @@ SeatingManager::SeatingManager(int vipCapacity,
     streamerOccupied(0),
     generalSeating(generalCapacity),
     generalCapacity(generalCapacity),
-    entryQueue(500),  // Increased capacity to handle more spectators
+    entryQueue(0, 4),  // One FIFO bucket per spectator priority
+    kioskIngress(1024),
     overflowQueue(500),  // Increased overflow queue capacity as well
     generalOccupied(0),
     overflowCount(0)
@@ -71,11 +72,6 @@ int getSpectatorPriority(SpectatorType type) {
 void SeatingManager::addToEntryQueue(const Spectator &s, bool /*quiet*/) {
     try {
         int priority = getSpectatorPriority(s.type);
-        
-        if (entryQueue.isFull()) {
-            return;
-        }
-        
         entryQueue.enqueue(s, priority);
     } catch (const std::exception& e) {
         std::cout << " Exception in addToEntryQueue for " << s.name << ": " << e.what() << "\n";
@@ -84,9 +80,24 @@ void SeatingManager::addToEntryQueue(const Spectator &s, bool /*quiet*/) {
     }
 }
 
+bool SeatingManager::submitFromKiosk(const Spectator &s) {
+    return kioskIngress.tryEnqueue(s);
+}
+
+int SeatingManager::drainKioskIngress() {
+    DynamicArray<Spectator> arrivals;
+    int count = kioskIngress.dequeueBatch(arrivals);
+    for (Spectator& s : arrivals) {
+        int priority = getSpectatorPriority(s.type);
+        entryQueue.enqueue(std::move(s), priority);
+    }
+    return count;
+}
+
 // Process everyone waiting to be seated
 void SeatingManager::processEntryQueue(bool verbose) {
     std::cout << "Processing spectators for seat assignments...\n";
+    drainKioskIngress();
     
     int processedCount = 0;
     while (!entryQueue.isEmpty()) {
@@ -445,7 +456,7 @@ void SeatingManager::displaySeatingStatus() const {
 
 // Helpers
 bool SeatingManager::assignVIPSeat(const Spectator &s, bool /*quiet*/) {
-    if (!vipSeating.isFull()) {
+    if (vipSeating.getSize() < vipCapacity) {
         // Find next available VIP seat for display tracking
         SeatPosition nextSeat;
         bool found = false;
@@ -536,7 +547,7 @@ bool SeatingManager::assignGeneralSeat(const Spectator &s, bool /*quiet*/) {
 }
 
 bool SeatingManager::assignGeneralSeatWithPriority(const Spectator &s, bool /*quiet*/, int priority) {
-    bool isFull = generalSeating.isFull();
+    bool isFull = generalSeating.getSize() >= generalCapacity;
     
     if (!isFull) {
         try {
@@ -631,54 +642,42 @@ void SeatingManager::handleOverflowManual(const DoublyLinkedList<Spectator>& vip
     
     // Put all spectators back into the overflow queue for processing
     // VIP overflow (highest priority)
-    for (int i = 0; i < vipOverflow.getSize(); ++i) {
-        const Spectator* spectator = vipOverflow.get(i);
-        if (spectator) {
-            try {
-                overflowQueue.enqueue(*spectator);
-                overflowCount++;
-            } catch (...) {
-                std::cout << "Warning: Could not re-add VIP spectator " << spectator->id << " to overflow queue.\n";
-            }
+    for (const Spectator& spectator : vipOverflow) {
+        try {
+            overflowQueue.enqueue(spectator);
+            overflowCount++;
+        } catch (...) {
+            std::cout << "Warning: Could not re-add VIP spectator " << spectator.id << " to overflow queue.\n";
         }
     }
     
     // Influencer overflow
-    for (int i = 0; i < influencerOverflow.getSize(); ++i) {
-        const Spectator* spectator = influencerOverflow.get(i);
-        if (spectator) {
-            try {
-                overflowQueue.enqueue(*spectator);
-                overflowCount++;
-            } catch (...) {
-                std::cout << "Warning: Could not re-add Influencer spectator " << spectator->id << " to overflow queue.\n";
-            }
+    for (const Spectator& spectator : influencerOverflow) {
+        try {
+            overflowQueue.enqueue(spectator);
+            overflowCount++;
+        } catch (...) {
+            std::cout << "Warning: Could not re-add Influencer spectator " << spectator.id << " to overflow queue.\n";
         }
     }
     
     // Streamer overflow
-    for (int i = 0; i < streamerOverflow.getSize(); ++i) {
-        const Spectator* spectator = streamerOverflow.get(i);
-        if (spectator) {
-            try {
-                overflowQueue.enqueue(*spectator);
-                overflowCount++;
-            } catch (...) {
-                std::cout << "Warning: Could not re-add Streamer spectator " << spectator->id << " to overflow queue.\n";
-            }
+    for (const Spectator& spectator : streamerOverflow) {
+        try {
+            overflowQueue.enqueue(spectator);
+            overflowCount++;
+        } catch (...) {
+            std::cout << "Warning: Could not re-add Streamer spectator " << spectator.id << " to overflow queue.\n";
         }
     }
     
     // Normal overflow
-    for (int i = 0; i < normalOverflow.getSize(); ++i) {
-        const Spectator* spectator = normalOverflow.get(i);
-        if (spectator) {
-            try {
-                overflowQueue.enqueue(*spectator);
-                overflowCount++;
-            } catch (...) {
-                std::cout << "Warning: Could not re-add Normal spectator " << spectator->id << " to overflow queue.\n";
-            }
+    for (const Spectator& spectator : normalOverflow) {
+        try {
+            overflowQueue.enqueue(spectator);
+            overflowCount++;
+        } catch (...) {
+            std::cout << "Warning: Could not re-add Normal spectator " << spectator.id << " to overflow queue.\n";
         }
     }
     
@@ -963,7 +962,7 @@ bool SeatingManager::assignSpectatorToSpecificSeat(const Spectator& spectator, i
     }
     
     // Verify general seating has space
-    if (generalSeating.isFull()) {
+    if (generalSeating.getSize() >= generalCapacity) {
         std::cout << "   General seating queue is full!\n";
         return false;
     }
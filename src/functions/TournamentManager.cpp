@@ -18,34 +18,64 @@ TournamentManager::~TournamentManager() {
 }
 
 void TournamentManager::loadTournamentsFromFile() {
-    tournaments.clear();
-    
+    // Callers reload before every status query; only touch what changed
+    FileWatch::Change change = tournamentsWatch.check();
+    if (change == FileWatch::Change::None) return;
+
+    std::uintmax_t journalOffset = tournamentsWatch.getJournalOffset();
+    if (change == FileWatch::Change::Replaced) {
+        tournaments.clear();
+        tournamentsById.clear();
+        tournamentsByName.clear();
+    }
+
     try {
-        DoublyLinkedList<Tournament> loadedTournaments = jsonLoader.loadTournaments("data/tournaments.json");
-
-        for (int i = 0; i < loadedTournaments.getSize(); i++) {
-            Tournament* tournament = loadedTournaments.get(i);
-            if (tournament) {
-                if (tournament->stage == TournamentStage::Registration) {
-                    if (registeringTournament) delete registeringTournament;
-                    registeringTournament = new Tournament(*tournament);
-                }
-                if (tournament->stage == TournamentStage::Qualifiers || 
-                    tournament->stage == TournamentStage::Quarterfinals || 
-                    tournament->stage == TournamentStage::Semifinals || 
-                    tournament->stage == TournamentStage::Finals) {
-                    if (ongoingTournament) delete ongoingTournament;
-                    ongoingTournament = new Tournament(*tournament);
-                }
-                tournaments.append(*tournament);
+        DoublyLinkedList<Tournament> loadedTournaments = change == FileWatch::Change::Appended
+            ? jsonLoader.loadAppendedTournaments("data/tournaments.json", journalOffset)
+            : jsonLoader.loadTournaments("data/tournaments.json", &journalOffset);
+
+        for (Tournament& tournament : loadedTournaments) {
+            if (tournament.stage == TournamentStage::Registration) {
+                if (registeringTournament) delete registeringTournament;
+                registeringTournament = new Tournament(tournament);
             }
+            if (tournament.stage == TournamentStage::Qualifiers || 
+                tournament.stage == TournamentStage::Quarterfinals || 
+                tournament.stage == TournamentStage::Semifinals || 
+                tournament.stage == TournamentStage::Finals) {
+                if (ongoingTournament) delete ongoingTournament;
+                ongoingTournament = new Tournament(tournament);
+            }
+            appendTournament(tournament);
         }
+        tournamentsWatch.loaded(journalOffset);
     } catch (const std::exception& e) {
         std::cerr << "Error loading tournaments: " << e.what() << std::endl;
         std::cout << "No tournaments loaded.\n";
+        tournamentsWatch.invalidate();
     }
 }
 
+// Append to the list and index the new tail (first id/name occurrence wins)
+void TournamentManager::appendTournament(const Tournament& tournament) {
+    tournaments.append(tournament);
+    auto tail = --tournaments.end();
+    if (!tournamentsById.contains(tournament.id)) {
+        tournamentsById.insert(tournament.id, tail);
+    }
+    if (!tournamentsByName.contains(tournament.name)) {
+        tournamentsByName.insert(tournament.name, tail);
+    }
+}
+
+void TournamentManager::eraseTournament(DoublyLinkedList<Tournament>::Iterator position) {
+    auto* byId = tournamentsById.find(position->id);
+    if (byId && *byId == position) tournamentsById.erase(position->id);
+    auto* byName = tournamentsByName.find(position->name);
+    if (byName && *byName == position) tournamentsByName.erase(position->name);
+    tournaments.erase(position);
+}
+
 bool TournamentManager::hasRegisteringTournament() {
     loadTournamentsFromFile(); // Ensure we have the latest tournament data
     return registeringTournament != nullptr;
@@ -80,10 +110,9 @@ bool TournamentManager::incrementParticipantCount() {
     registeringTournament->currentParticipants++;
     
     // Update the tournament in the tournaments list as well
-    for (int i = 0; i < tournaments.getSize(); i++) {
-        Tournament* tournament = tournaments.get(i);
-        if (tournament && tournament->id == registeringTournament->id) {
-            tournament->currentParticipants = registeringTournament->currentParticipants;
+    for (Tournament& tournament : tournaments) {
+        if (tournament.id == registeringTournament->id) {
+            tournament.currentParticipants = registeringTournament->currentParticipants;
             break;
         }
     }
@@ -111,10 +140,9 @@ bool TournamentManager::decrementParticipantCount() {
     registeringTournament->currentParticipants--;
     
     // Update the tournament in the tournaments list as well
-    for (int i = 0; i < tournaments.getSize(); i++) {
-        Tournament* tournament = tournaments.get(i);
-        if (tournament && tournament->id == registeringTournament->id) {
-            tournament->currentParticipants = registeringTournament->currentParticipants;
+    for (Tournament& tournament : tournaments) {
+        if (tournament.id == registeringTournament->id) {
+            tournament.currentParticipants = registeringTournament->currentParticipants;
             break;
         }
     }
@@ -129,9 +157,8 @@ bool TournamentManager::decrementParticipantCount() {
 }
 
 bool TournamentManager::hasDuplicateTournament(const std::string& name, const std::string& startDate, const std::string& endDate) const {
-    for (int i = 0; i < tournaments.getSize(); i++) {
-        Tournament* tournament = tournaments.get(i);
-        if (tournament && tournament->name == name && tournament->startDate == startDate && tournament->endDate == endDate) {
+    for (const Tournament& tournament : tournaments) {
+        if (tournament.name == name && tournament.startDate == startDate && tournament.endDate == endDate) {
             return true;
         }
     }
@@ -177,11 +204,10 @@ void TournamentManager::createTournament() {
     
     // Generate new tournament ID
     int maxId = 0;
-    for (int i = 0; i < tournaments.getSize(); i++) {
-        Tournament* tournament = tournaments.get(i);
-        if (tournament && !tournament->id.empty() && tournament->id.length() >= 2) {
+    for (Tournament& tournament : tournaments) {
+        if (!tournament.id.empty() && tournament.id.length() >= 2) {
             // Extract numeric part from "T00000" format
-            std::string numericPart = tournament->id.substr(1);
+            std::string numericPart = tournament.id.substr(1);
             try {
                 int id = std::stoi(numericPart);
                 if (id > maxId) {
@@ -299,7 +325,7 @@ void TournamentManager::createTournament() {
     newTournament.currentParticipants = 0;
     
     // Add to tournaments list
-    tournaments.append(newTournament);
+    appendTournament(newTournament);
     if (registeringTournament) delete registeringTournament;
     registeringTournament = new Tournament(newTournament);
 
@@ -309,7 +335,7 @@ void TournamentManager::createTournament() {
     std::cout << "\nTournament created successfully!\n";
     std::cout << "Tournament ID: " << newTournament.id << std::endl;
     std::cout << "Tournament Name: " << newTournament.name << std::endl;
-    std::cout << "Stage: " << JsonWriter::tournamentStageToString(newTournament.stage) << std::endl;
+    std::cout << "Stage: " << toString(newTournament.stage) << std::endl;
 }
 
 void TournamentManager::displayTournamentDetails() {
@@ -327,8 +353,8 @@ void TournamentManager::displayTournamentDetails() {
     std::cout << std::left << std::setw(20) << "Location:" << registeringTournament->location << std::endl;
 
     // Convert enums to strings for display
-    std::string categoryStr = JsonWriter::tournamentCategoryToString(registeringTournament->category);
-    std::string stageStr = JsonWriter::tournamentStageToString(registeringTournament->stage);
+    std::string_view categoryStr = toString(registeringTournament->category);
+    std::string_view stageStr = toString(registeringTournament->stage);
 
     std::cout << std::left << std::setw(20) << "Category:" << categoryStr << std::endl;
     std::cout << std::left << std::setw(20) << "Stage:" << stageStr << std::endl;
@@ -356,20 +382,17 @@ void TournamentManager::displayAllTournaments() const {
               << std::setw(15) << "Stage" << std::endl;
     std::cout << std::string(107, '-') << std::endl;
     
-    for (int i = 0; i < tournaments.getSize(); i++) {
-        Tournament* tournament = tournaments.get(i);
-        if (tournament) {
-            std::string categoryStr = JsonWriter::tournamentCategoryToString(tournament->category);
-            std::string stageStr = JsonWriter::tournamentStageToString(tournament->stage);
-
-            std::cout << std::left << std::setw(5) << tournament->id
-                      << std::setw(25) << tournament->name.substr(0, 24)
-                      << std::setw(12) << tournament->startDate
-                      << std::setw(15) << tournament->endDate
-                      << std::setw(15) << tournament->location.substr(0, 14)
-                      << std::setw(15) << categoryStr
-                      << std::setw(15) << stageStr << std::endl;
-        }
+    for (const Tournament& tournament : tournaments) {
+        std::string_view categoryStr = toString(tournament.category);
+        std::string_view stageStr = toString(tournament.stage);
+
+        std::cout << std::left << std::setw(5) << tournament.id
+                  << std::setw(25) << tournament.name.substr(0, 24)
+                  << std::setw(12) << tournament.startDate
+                  << std::setw(15) << tournament.endDate
+                  << std::setw(15) << tournament.location.substr(0, 14)
+                  << std::setw(15) << categoryStr
+                  << std::setw(15) << stageStr << std::endl;
     }
     std::cout << "======================== END ========================\n";
 }
@@ -383,12 +406,9 @@ void TournamentManager::endCurrentTournament() {
     std::cout << "Cancelling current tournament: " << registeringTournament->name << " (ID: " << registeringTournament->id << ")\n";
 
     // Remove the registering tournament from the list
-    for (int i = 0; i < tournaments.getSize(); i++) {
-        Tournament* tournament = tournaments.get(i);
-        if (tournament && tournament->id == registeringTournament->id) {
-            tournaments.removeAt(i);
-            break;
-        }
+    auto* registered = tournamentsById.find(registeringTournament->id);
+    if (registered) {
+        eraseTournament(*registered);
     }
 
     // Save changes to file
@@ -431,10 +451,9 @@ bool TournamentManager::endRegisteringTournament(const int currentParticipants)
     registeringTournament->currentParticipants = currentParticipants;
 
     // Update the tournament in the list
-    for (int i = 0; i < tournaments.getSize(); i++) {
-        Tournament* tournament = tournaments.get(i);
-        if (tournament && tournament->id == registeringTournament->id) {
-            *tournament = *registeringTournament; // Update the existing tournament
+    for (Tournament& tournament : tournaments) {
+        if (tournament.id == registeringTournament->id) {
+            tournament = *registeringTournament; // Update the existing tournament
             break;
         }
     }
@@ -455,31 +474,20 @@ bool TournamentManager::endRegisteringTournament(const int currentParticipants)
 }
 
 Tournament* TournamentManager::findTournamentById(const std::string& id) const {
-    for (int i = 0; i < tournaments.getSize(); i++) {
-        Tournament* tournament = tournaments.get(i);
-        if (tournament && tournament->id == id) {
-            return tournament;
-        }
-    }
-    return nullptr;
+    auto* found = tournamentsById.find(id);
+    return found ? &**found : nullptr;
 }
 
 Tournament* TournamentManager::findTournamentByName(const std::string& name) const {
-    for (int i = 0; i < tournaments.getSize(); i++) {
-        Tournament* tournament = tournaments.get(i);
-        if (tournament && tournament->name == name) {
-            return tournament;
-        }
-    }
-    return nullptr;
+    auto* found = tournamentsByName.find(name);
+    return found ? &**found : nullptr;
 }
 
 DoublyLinkedList<Tournament> TournamentManager::getTournamentsByCategory(TournamentCategory category) const {
     DoublyLinkedList<Tournament> result;
-    for (int i = 0; i < tournaments.getSize(); i++) {
-        Tournament* tournament = tournaments.get(i);
-        if (tournament && tournament->category == category) {
-            result.append(*tournament);
+    for (const Tournament& tournament : tournaments) {
+        if (tournament.category == category) {
+            result.append(tournament);
         }
     }
     return result;
@@ -487,10 +495,9 @@ DoublyLinkedList<Tournament> TournamentManager::getTournamentsByCategory(Tournam
 
 DoublyLinkedList<Tournament> TournamentManager::getTournamentsByStage(TournamentStage stage) const {
     DoublyLinkedList<Tournament> result;
-    for (int i = 0; i < tournaments.getSize(); i++) {
-        Tournament* tournament = tournaments.get(i);
-        if (tournament && tournament->stage == stage) {
-            result.append(*tournament);
+    for (const Tournament& tournament : tournaments) {
+        if (tournament.stage == stage) {
+            result.append(tournament);
         }
     }
     return result;
@@ -526,13 +533,10 @@ void TournamentManager::displayTournamentStatistics() const {
     int completedCount = 0;
     double totalPrizePool = 0.0;
     
-    for (int i = 0; i < tournaments.getSize(); i++) {
-        Tournament* tournament = tournaments.get(i);
-        if (tournament) {
-            if (tournament->stage == TournamentStage::Registration) activeCount++;
-            if (tournament->stage == TournamentStage::Completed) completedCount++;
-            totalPrizePool += tournament->prizePool;
-        }
+    for (const Tournament& tournament : tournaments) {
+        if (tournament.stage == TournamentStage::Registration) activeCount++;
+        if (tournament.stage == TournamentStage::Completed) completedCount++;
+        totalPrizePool += tournament.prizePool;
     }
     
     std::cout << "Active Tournaments: " << activeCount << std::endl;
@@ -542,27 +546,25 @@ void TournamentManager::displayTournamentStatistics() const {
 }
 
 bool TournamentManager::deleteTournament(const std::string& tournamentId) {
-    for (int i = 0; i < tournaments.getSize(); i++) {
-        Tournament* tournament = tournaments.get(i);
-        if (tournament && tournament->id == tournamentId) {
-            std::string tournamentName = tournament->name;
-            
-            // If this is the active tournament, clear the active pointer
-            if (registeringTournament && registeringTournament->id == tournamentId) {
-                delete registeringTournament;
-                registeringTournament = nullptr;
-            }
-            if (ongoingTournament && ongoingTournament->id == tournamentId) {
-                delete ongoingTournament;
-                ongoingTournament = nullptr;
-            }
-            
-            tournaments.removeAt(i);
-            saveTournaments();
-            
-            std::cout << "Tournament '" << tournamentName << "' has been deleted.\n";
-            return true;
+    auto* found = tournamentsById.find(tournamentId);
+    if (found) {
+        std::string tournamentName = (*found)->name;
+        
+        // If this is the active tournament, clear the active pointer
+        if (registeringTournament && registeringTournament->id == tournamentId) {
+            delete registeringTournament;
+            registeringTournament = nullptr;
         }
+        if (ongoingTournament && ongoingTournament->id == tournamentId) {
+            delete ongoingTournament;
+            ongoingTournament = nullptr;
+        }
+        
+        eraseTournament(*found);
+        saveTournaments();
+        
+        std::cout << "Tournament '" << tournamentName << "' has been deleted.\n";
+        return true;
     }
     
     std::cout << "Tournament with ID " << tournamentId << " not found.\n";
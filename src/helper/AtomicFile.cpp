@@ -0,0 +1,135 @@
+#include "helper/AtomicFile.hpp"
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <io.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// Open for writing; returns -1 on failure
+static int openForWrite(const std::string& path, bool append) {
+#ifdef _WIN32
+    int flags = _O_WRONLY | _O_CREAT | _O_BINARY | (append ? _O_APPEND : _O_TRUNC);
+    return _open(path.c_str(), flags, _S_IREAD | _S_IWRITE);
+#else
+    int flags = O_WRONLY | O_CREAT | O_CLOEXEC | (append ? O_APPEND : O_TRUNC);
+    return ::open(path.c_str(), flags, 0644);
+#endif
+}
+
+// Write everything, then flush it to the device
+static bool writeAllAndSync(int fd, const std::string& contents) {
+    const char* data = contents.data();
+    std::size_t remaining = contents.size();
+    while (remaining > 0) {
+#ifdef _WIN32
+        int written = _write(fd, data, static_cast<unsigned int>(remaining > 0x40000000 ? 0x40000000 : remaining));
+#else
+        ssize_t written = ::write(fd, data, remaining);
+#endif
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        data += written;
+        remaining -= static_cast<std::size_t>(written);
+    }
+#ifdef _WIN32
+    return _commit(fd) == 0;
+#else
+    return ::fsync(fd) == 0;
+#endif
+}
+
+static void closeFile(int fd) {
+#ifdef _WIN32
+    _close(fd);
+#else
+    ::close(fd);
+#endif
+}
+
+#ifndef _WIN32
+// Make the rename itself durable (Windows uses MOVEFILE_WRITE_THROUGH instead)
+static void syncDirectoryOf(const std::string& filename) {
+    std::string directory = std::filesystem::path(filename).parent_path().string();
+    if (directory.empty()) directory = ".";
+    int fd = ::open(directory.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return;
+    ::fsync(fd);
+    ::close(fd);
+}
+#endif
+
+std::string AtomicFile::tempPath(const std::string& filename) {
+    return filename + ".tmp";
+}
+
+bool AtomicFile::write(const std::string& filename, const std::string& contents) {
+    return writeTemp(filename, contents) && commitTemp(filename);
+}
+
+bool AtomicFile::writeTemp(const std::string& filename, const std::string& contents) {
+    std::string temp = tempPath(filename);
+    int fd = openForWrite(temp, false);
+    if (fd < 0) {
+        std::cerr << "Failed to create " << temp << ": " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    bool ok = writeAllAndSync(fd, contents);
+    closeFile(fd);
+    if (!ok) {
+        std::cerr << "Failed to write " << temp << ": " << std::strerror(errno) << std::endl;
+        std::remove(temp.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool AtomicFile::commitTemp(const std::string& filename) {
+    std::string temp = tempPath(filename);
+    if (!rename(temp, filename)) {
+        std::remove(temp.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool AtomicFile::rename(const std::string& from, const std::string& to) {
+#ifdef _WIN32
+    if (!MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH)) {
+        std::cerr << "Failed to replace " << to << std::endl;
+        return false;
+    }
+#else
+    if (std::rename(from.c_str(), to.c_str()) != 0) {
+        std::cerr << "Failed to replace " << to << ": " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    syncDirectoryOf(to);
+#endif
+    return true;
+}
+
+bool AtomicFile::append(const std::string& filename, const std::string& contents) {
+    int fd = openForWrite(filename, true);
+    if (fd < 0) {
+        std::cerr << "Failed to open " << filename << ": " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    bool ok = writeAllAndSync(fd, contents);
+    closeFile(fd);
+    return ok;
+}
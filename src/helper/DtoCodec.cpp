@@ -0,0 +1,512 @@
+#include "helper/DtoCodec.hpp"
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+
+// ---- Lookup ----
+
+template <typename T>
+struct FieldEntry {
+    std::string_view key;
+    typename DtoFields<T>::Setter set;
+};
+
+// Files are written with a fixed key order, so try the entry after the last
+// match before falling back to a scan of the (short) table
+template <typename T, std::size_t N>
+static typename DtoFields<T>::Setter lookup(const FieldEntry<T> (&table)[N], std::string_view key, int& hint) {
+    int next = hint + 1 < static_cast<int>(N) ? hint + 1 : 0;
+    if (table[next].key == key) {
+        hint = next;
+        return table[next].set;
+    }
+    for (std::size_t i = 0; i < N; ++i) {
+        if (table[i].key == key) {
+            hint = static_cast<int>(i);
+            return table[i].set;
+        }
+    }
+    return nullptr;
+}
+
+// ---- Enum parsing straight from the parser's buffer (no temporaries) ----
+
+static Gender genderFrom(std::string_view text) {
+    return enumFromString(text, Gender::Female);
+}
+
+static TournamentStage stageFrom(std::string_view text) {
+    return enumFromString(text, TournamentStage::Qualifiers);
+}
+
+static TournamentCategory categoryFrom(std::string_view text) {
+    return enumFromString(text, TournamentCategory::Local);
+}
+
+static SpectatorType spectatorTypeFrom(std::string_view text) {
+    return enumFromString(text, SpectatorType::Normal);
+}
+
+static Champion championFrom(const SaxScalar& value) {
+    if (!value.isString()) {
+        long long index = value.asInt();
+        if (index < 0 || index > static_cast<long long>(Champion::NoChampion)) return Champion::NoChampion;
+        return static_cast<Champion>(index);
+    }
+    return enumFromString(value.view(), Champion::NoChampion);
+}
+
+// ---- Player ----
+
+static void playerAge(Player& p, SaxScalar& v) { p.age = static_cast<int>(v.asInt()); }
+static void playerDateJoined(Player& p, SaxScalar& v) { v.moveTo(p.dateJoined); }
+static void playerEmail(Player& p, SaxScalar& v) { v.moveTo(p.email); }
+static void playerGender(Player& p, SaxScalar& v) { p.gender = genderFrom(v.view()); }
+static void playerId(Player& p, SaxScalar& v) { v.moveTo(p.id); }
+static void playerIsEarlyBird(Player& p, SaxScalar& v) { p.isEarlyBird = v.asBool(); }
+static void playerIsLate(Player& p, SaxScalar& v) { p.isLate = v.asBool(); }
+static void playerIsWildcard(Player& p, SaxScalar& v) { p.isWildcard = v.asBool(); }
+static void playerName(Player& p, SaxScalar& v) { v.moveTo(p.name); }
+static void playerPhoneNum(Player& p, SaxScalar& v) { v.moveTo(p.phoneNum); }
+static void playerPoints(Player& p, SaxScalar& v) { p.points = static_cast<int>(v.asInt()); }
+
+// Tables list keys in the order the writer emits them (alphabetical)
+static const FieldEntry<Player> PLAYER_FIELDS[] = {
+    {"age", playerAge},
+    {"dateJoined", playerDateJoined},
+    {"email", playerEmail},
+    {"gender", playerGender},
+    {"id", playerId},
+    {"isEarlyBird", playerIsEarlyBird},
+    {"isLate", playerIsLate},
+    {"isWildcard", playerIsWildcard},
+    {"name", playerName},
+    {"phoneNum", playerPhoneNum},
+    {"points", playerPoints},
+};
+
+template <>
+DtoFields<Player>::Setter DtoFields<Player>::find(std::string_view key, int& hint) {
+    return lookup(PLAYER_FIELDS, key, hint);
+}
+
+// ---- CheckedInRecord: the player fields plus "priority" ----
+
+template <void (*Set)(Player&, SaxScalar&)>
+static void onPlayer(CheckedInRecord& r, SaxScalar& v) { Set(r.player, v); }
+
+static void checkInPriority(CheckedInRecord& r, SaxScalar& v) { r.priority = static_cast<int>(v.asInt()); }
+
+static const FieldEntry<CheckedInRecord> CHECKED_IN_FIELDS[] = {
+    {"age", onPlayer<playerAge>},
+    {"dateJoined", onPlayer<playerDateJoined>},
+    {"email", onPlayer<playerEmail>},
+    {"gender", onPlayer<playerGender>},
+    {"id", onPlayer<playerId>},
+    {"isEarlyBird", onPlayer<playerIsEarlyBird>},
+    {"isLate", onPlayer<playerIsLate>},
+    {"isWildcard", onPlayer<playerIsWildcard>},
+    {"name", onPlayer<playerName>},
+    {"phoneNum", onPlayer<playerPhoneNum>},
+    {"points", onPlayer<playerPoints>},
+    {"priority", checkInPriority},
+};
+
+template <>
+DtoFields<CheckedInRecord>::Setter DtoFields<CheckedInRecord>::find(std::string_view key, int& hint) {
+    return lookup(CHECKED_IN_FIELDS, key, hint);
+}
+
+// ---- Match ----
+
+static const FieldEntry<Match> MATCH_FIELDS[] = {
+    {"date", [](Match& m, SaxScalar& v) { v.moveTo(m.date); }},
+    {"id", [](Match& m, SaxScalar& v) { v.moveTo(m.id); }},
+    {"player1", [](Match& m, SaxScalar& v) { v.moveTo(m.player1); }},
+    {"player2", [](Match& m, SaxScalar& v) { v.moveTo(m.player2); }},
+    {"stage", [](Match& m, SaxScalar& v) { m.stage = stageFrom(v.view()); }},
+    {"time", [](Match& m, SaxScalar& v) { v.moveTo(m.time); }},
+    {"tournamentId", [](Match& m, SaxScalar& v) { v.moveTo(m.tournamentId); }},
+};
+
+template <>
+DtoFields<Match>::Setter DtoFields<Match>::find(std::string_view key, int& hint) {
+    return lookup(MATCH_FIELDS, key, hint);
+}
+
+// ---- Performance ----
+
+static void performanceMatches(Performance& p, SaxScalar& v) { p.matchesPlayed = static_cast<int>(v.asInt()); }
+
+static const FieldEntry<Performance> PERFORMANCE_FIELDS[] = {
+    {"favouriteChampion", [](Performance& p, SaxScalar& v) { p.favouriteChampion = championFrom(v); }},
+    {"lastWin", [](Performance& p, SaxScalar& v) { v.moveTo(p.lastWin); }},
+    {"matchPlayed", performanceMatches},    // Older files
+    {"matchesPlayed", performanceMatches},  // What JsonWriter writes
+    {"playerId", [](Performance& p, SaxScalar& v) { v.moveTo(p.playerId); }},
+    {"winRate", [](Performance& p, SaxScalar& v) { p.winRate = static_cast<float>(v.asDouble()); }},
+};
+
+template <>
+DtoFields<Performance>::Setter DtoFields<Performance>::find(std::string_view key, int& hint) {
+    return lookup(PERFORMANCE_FIELDS, key, hint);
+}
+
+// ---- Result ----
+
+static const FieldEntry<Result> RESULT_FIELDS[] = {
+    {"championsP1", [](Result& r, SaxScalar& v) { r.championsP1 = championFrom(v); }},
+    {"championsP2", [](Result& r, SaxScalar& v) { r.championsP2 = championFrom(v); }},
+    {"id", [](Result& r, SaxScalar& v) { v.moveTo(r.id); }},
+    {"matchId", [](Result& r, SaxScalar& v) { v.moveTo(r.matchId); }},
+    {"winnerId", [](Result& r, SaxScalar& v) { v.moveTo(r.winnerId); }},
+};
+
+template <>
+DtoFields<Result>::Setter DtoFields<Result>::find(std::string_view key, int& hint) {
+    return lookup(RESULT_FIELDS, key, hint);
+}
+
+// ---- Spectator ----
+
+// "S00001" -> 1 (a bare number is accepted too)
+static void spectatorId(Spectator& s, SaxScalar& v) {
+    if (!v.isString()) {
+        s.id = static_cast<int>(v.asInt());
+        return;
+    }
+    std::string_view text = v.view();
+    int id = 0;
+    if (text.size() > 1 && text[0] == 'S') {
+        std::from_chars(text.data() + 1, text.data() + text.size(), id);
+    }
+    s.id = id;
+}
+
+static const FieldEntry<Spectator> SPECTATOR_FIELDS[] = {
+    {"affiliation", [](Spectator& s, SaxScalar& v) { v.moveTo(s.affiliation); }},
+    {"email", [](Spectator& s, SaxScalar& v) { v.moveTo(s.email); }},
+    {"gender", [](Spectator& s, SaxScalar& v) { s.gender = genderFrom(v.view()); }},
+    {"id", spectatorId},
+    {"name", [](Spectator& s, SaxScalar& v) { v.moveTo(s.name); }},
+    {"phoneNum", [](Spectator& s, SaxScalar& v) { v.moveTo(s.phoneNum); }},
+    {"type", [](Spectator& s, SaxScalar& v) { s.type = spectatorTypeFrom(v.view()); }},
+};
+
+template <>
+DtoFields<Spectator>::Setter DtoFields<Spectator>::find(std::string_view key, int& hint) {
+    return lookup(SPECTATOR_FIELDS, key, hint);
+}
+
+// ---- Tournament ----
+
+static const FieldEntry<Tournament> TOURNAMENT_FIELDS[] = {
+    {"category", [](Tournament& t, SaxScalar& v) { t.category = categoryFrom(v.view()); }},
+    {"currentParticipants", [](Tournament& t, SaxScalar& v) { t.currentParticipants = static_cast<int>(v.asInt()); }},
+    {"endDate", [](Tournament& t, SaxScalar& v) { v.moveTo(t.endDate); }},
+    {"id", [](Tournament& t, SaxScalar& v) { v.moveTo(t.id); }},
+    {"location", [](Tournament& t, SaxScalar& v) { v.moveTo(t.location); }},
+    {"maxParticipants", [](Tournament& t, SaxScalar& v) { t.maxParticipants = static_cast<int>(v.asInt()); }},
+    {"name", [](Tournament& t, SaxScalar& v) { v.moveTo(t.name); }},
+    {"prizePool", [](Tournament& t, SaxScalar& v) { t.prizePool = v.asDouble(); }},
+    {"stage", [](Tournament& t, SaxScalar& v) { t.stage = stageFrom(v.view()); }},
+    {"startDate", [](Tournament& t, SaxScalar& v) { v.moveTo(t.startDate); }},
+};
+
+template <>
+DtoFields<Tournament>::Setter DtoFields<Tournament>::find(std::string_view key, int& hint) {
+    return lookup(TOURNAMENT_FIELDS, key, hint);
+}
+
+// ---- Writing ----
+
+std::string DtoCodec::formatSpectatorId(int id) {
+    std::string digits = std::to_string(id);
+    return "S" + std::string(digits.size() < 5 ? 5 - digits.size() : 0, '0') + digits;
+}
+
+nlohmann::json DtoCodec::toJson(const Player& player) {
+    return nlohmann::json{
+        {"id", player.id},
+        {"name", player.name},
+        {"age", player.age},
+        {"gender", toString(player.gender)},
+        {"email", player.email},
+        {"phoneNum", player.phoneNum},
+        {"points", player.points},
+        {"isEarlyBird", player.isEarlyBird},
+        {"isWildcard", player.isWildcard},
+        {"isLate", player.isLate},
+        {"dateJoined", player.dateJoined}
+    };
+}
+
+nlohmann::json DtoCodec::toJson(const CheckedInRecord& record) {
+    nlohmann::json data = toJson(record.player);
+    data["priority"] = record.priority;
+    return data;
+}
+
+nlohmann::json DtoCodec::toJson(const Match& match) {
+    return nlohmann::json{
+        {"id", match.id},
+        {"tournamentId", match.tournamentId},
+        {"stage", toString(match.stage)},
+        {"date", match.date},
+        {"time", match.time},
+        {"player1", match.player1},
+        {"player2", match.player2}
+    };
+}
+
+nlohmann::json DtoCodec::toJson(const Performance& performance) {
+    return nlohmann::json{
+        {"playerId", performance.playerId},
+        {"matchesPlayed", performance.matchesPlayed},
+        {"favouriteChampion", performance.favouriteChampion},
+        {"lastWin", performance.lastWin},
+        {"winRate", performance.winRate}
+    };
+}
+
+nlohmann::json DtoCodec::toJson(const Result& result) {
+    return nlohmann::json{
+        {"id", result.id},
+        {"matchId", result.matchId},
+        {"championsP1", toString(result.championsP1)},
+        {"championsP2", toString(result.championsP2)},
+        {"winnerId", result.winnerId}
+    };
+}
+
+nlohmann::json DtoCodec::toJson(const Spectator& spectator) {
+    return nlohmann::json{
+        {"id", formatSpectatorId(spectator.id)},
+        {"name", spectator.name},
+        {"gender", toString(spectator.gender)},
+        {"email", spectator.email},
+        {"phoneNum", spectator.phoneNum},
+        {"type", toString(spectator.type)},
+        {"affiliation", spectator.affiliation}
+    };
+}
+
+nlohmann::json DtoCodec::toJson(const Tournament& tournament) {
+    return nlohmann::json{
+        {"id", tournament.id},
+        {"name", tournament.name},
+        {"startDate", tournament.startDate},
+        {"endDate", tournament.endDate},
+        {"location", tournament.location},
+        {"stage", toString(tournament.stage)},
+        {"category", toString(tournament.category)},
+        {"maxParticipants", tournament.maxParticipants},
+        {"currentParticipants", tournament.currentParticipants},
+        {"prizePool", tournament.prizePool}
+    };
+}
+
+// Length of the well-formed UTF-8 sequence at text[i], or 0 (the same
+// sequences nlohmann's serializer rejects)
+static std::size_t utf8Length(std::string_view text, std::size_t i) {
+    unsigned char lead = static_cast<unsigned char>(text[i]);
+    std::size_t length;
+    unsigned char low = 0x80, high = 0xBF;
+    if (lead >= 0xC2 && lead <= 0xDF) length = 2;
+    else if (lead == 0xE0) { length = 3; low = 0xA0; }
+    else if (lead == 0xED) { length = 3; high = 0x9F; }    // No surrogates
+    else if (lead >= 0xE1 && lead <= 0xEF) length = 3;
+    else if (lead == 0xF0) { length = 4; low = 0x90; }
+    else if (lead == 0xF4) { length = 4; high = 0x8F; }    // Up to U+10FFFF
+    else if (lead >= 0xF1 && lead <= 0xF3) length = 4;
+    else return 0;
+    if (text.size() - i < length) return 0;
+    unsigned char second = static_cast<unsigned char>(text[i + 1]);
+    if (second < low || second > high) return 0;
+    for (std::size_t k = 2; k < length; ++k) {
+        unsigned char next = static_cast<unsigned char>(text[i + k]);
+        if (next < 0x80 || next > 0xBF) return 0;
+    }
+    return length;
+}
+
+// Quote and escape text exactly like json::dump(): named escapes for the
+// usual controls, \u00xx for the rest, UTF-8 passed through unchanged
+static void appendString(std::string& out, std::string_view text) {
+    static const char HEX[] = "0123456789abcdef";
+    out += '"';
+    std::size_t plain = 0;
+    for (std::size_t i = 0; i < text.size(); ++i) {
+        unsigned char c = static_cast<unsigned char>(text[i]);
+        if (c >= 0x20 && c < 0x80 && c != '"' && c != '\\') continue;
+
+        out.append(text.data() + plain, i - plain);
+        if (c >= 0x80) {
+            std::size_t length = utf8Length(text, i);
+            if (length == 0) throw std::runtime_error("invalid UTF-8 byte in string");
+            out.append(text.data() + i, length);
+            i += length - 1;
+        } else {
+            switch (c) {
+                case '"': out += "\\\""; break;
+                case '\\': out += "\\\\"; break;
+                case '\b': out += "\\b"; break;
+                case '\f': out += "\\f"; break;
+                case '\n': out += "\\n"; break;
+                case '\r': out += "\\r"; break;
+                case '\t': out += "\\t"; break;
+                default:
+                    out += "\\u00";
+                    out += HEX[c >> 4];
+                    out += HEX[c & 0xF];
+            }
+        }
+        plain = i + 1;
+    }
+    out.append(text.data() + plain, text.size() - plain);
+    out += '"';
+}
+
+static void appendInt(std::string& out, long long value) {
+    char buffer[24];
+    char* end = std::to_chars(buffer, buffer + sizeof(buffer), value).ptr;
+    out.append(buffer, static_cast<std::size_t>(end - buffer));
+}
+
+// Shortest round-trip form, via the same Grisu2 code json::dump() uses
+static void appendDouble(std::string& out, double value) {
+    if (!std::isfinite(value)) {
+        out += "null";
+        return;
+    }
+    char buffer[64];
+    char* end = nlohmann::detail::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, static_cast<std::size_t>(end - buffer));
+}
+
+// One array element in json::dump(4) layout. Fields must be added in sorted
+// key order, which is how nlohmann's std::map-backed objects print them.
+class PrettyRecord {
+public:
+    explicit PrettyRecord(std::string& out) : out(out), first(true) {
+        out += "    {";
+    }
+
+    ~PrettyRecord() {
+        out += first ? "}" : "\n    }";
+    }
+
+    void add(std::string_view key, std::string_view value) {
+        appendKey(key);
+        appendString(out, value);
+    }
+
+    void add(std::string_view key, const std::string& value) {
+        add(key, std::string_view(value));
+    }
+
+    void add(std::string_view key, int value) {
+        appendKey(key);
+        appendInt(out, value);
+    }
+
+    void add(std::string_view key, double value) {
+        appendKey(key);
+        appendDouble(out, value);
+    }
+
+    void add(std::string_view key, bool value) {
+        appendKey(key);
+        out += value ? "true" : "false";
+    }
+
+private:
+    std::string& out;
+    bool first;
+
+    void appendKey(std::string_view key) {
+        out += first ? "\n        \"" : ",\n        \"";
+        first = false;
+        out += key;
+        out += "\": ";
+    }
+};
+
+static void addPlayerFields(PrettyRecord& record, const Player& player) {
+    record.add("age", player.age);
+    record.add("dateJoined", player.dateJoined);
+    record.add("email", player.email);
+    record.add("gender", toString(player.gender));
+    record.add("id", player.id);
+    record.add("isEarlyBird", player.isEarlyBird);
+    record.add("isLate", player.isLate);
+    record.add("isWildcard", player.isWildcard);
+    record.add("name", player.name);
+    record.add("phoneNum", player.phoneNum);
+    record.add("points", player.points);
+}
+
+void DtoCodec::appendPrettyJson(std::string& out, const Player& player) {
+    PrettyRecord record(out);
+    addPlayerFields(record, player);
+}
+
+void DtoCodec::appendPrettyJson(std::string& out, const CheckedInRecord& checkedIn) {
+    PrettyRecord record(out);
+    addPlayerFields(record, checkedIn.player);
+    record.add("priority", checkedIn.priority);
+}
+
+void DtoCodec::appendPrettyJson(std::string& out, const Match& match) {
+    PrettyRecord record(out);
+    record.add("date", match.date);
+    record.add("id", match.id);
+    record.add("player1", match.player1);
+    record.add("player2", match.player2);
+    record.add("stage", toString(match.stage));
+    record.add("time", match.time);
+    record.add("tournamentId", match.tournamentId);
+}
+
+void DtoCodec::appendPrettyJson(std::string& out, const Performance& performance) {
+    PrettyRecord record(out);
+    record.add("favouriteChampion", static_cast<int>(performance.favouriteChampion));
+    record.add("lastWin", performance.lastWin);
+    record.add("matchesPlayed", performance.matchesPlayed);
+    record.add("playerId", performance.playerId);
+    record.add("winRate", static_cast<double>(performance.winRate));
+}
+
+void DtoCodec::appendPrettyJson(std::string& out, const Result& result) {
+    PrettyRecord record(out);
+    record.add("championsP1", toString(result.championsP1));
+    record.add("championsP2", toString(result.championsP2));
+    record.add("id", result.id);
+    record.add("matchId", result.matchId);
+    record.add("winnerId", result.winnerId);
+}
+
+void DtoCodec::appendPrettyJson(std::string& out, const Spectator& spectator) {
+    PrettyRecord record(out);
+    record.add("affiliation", spectator.affiliation);
+    record.add("email", spectator.email);
+    record.add("gender", toString(spectator.gender));
+    record.add("id", formatSpectatorId(spectator.id));
+    record.add("name", spectator.name);
+    record.add("phoneNum", spectator.phoneNum);
+    record.add("type", toString(spectator.type));
+}
+
+void DtoCodec::appendPrettyJson(std::string& out, const Tournament& tournament) {
+    PrettyRecord record(out);
+    record.add("category", toString(tournament.category));
+    record.add("currentParticipants", tournament.currentParticipants);
+    record.add("endDate", tournament.endDate);
+    record.add("id", tournament.id);
+    record.add("location", tournament.location);
+    record.add("maxParticipants", tournament.maxParticipants);
+    record.add("name", tournament.name);
+    record.add("prizePool", tournament.prizePool);
+    record.add("stage", toString(tournament.stage));
+    record.add("startDate", tournament.startDate);
+}
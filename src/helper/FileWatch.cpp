@@ -0,0 +1,296 @@
+#include "helper/FileWatch.hpp"
+#include "helper/JsonJournal.hpp"
+#include "helper/MappedFile.hpp"
+#include "helper/WriteBehindCache.hpp"
+#include "structures/HashMap.hpp"
+#include <fstream>
+#include <mutex>
+#include <string_view>
+
+#ifdef __linux__
+#include <cerrno>
+#include <climits>
+#include <fcntl.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+#ifndef _WIN32
+#include <sys/stat.h>
+#endif
+
+static const std::uint64_t HASH_BASIS = 14695981039346656037ULL;
+
+// 64-bit FNV-1a, continued from hash
+static std::uint64_t extendHash(std::uint64_t hash, std::string_view bytes) {
+    for (unsigned char c : bytes) {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+static std::uint64_t hashFile(const std::string& path) {
+    MappedFile file(path);
+    return extendHash(HASH_BASIS, file.view());
+}
+
+// Continue hash over bytes [from, to) of path; false if they are not all there
+static bool extendHashFromFile(const std::string& path, std::uintmax_t from, std::uintmax_t to, std::uint64_t& hash) {
+    if (from >= to) return true;
+    std::ifstream in(path, std::ios::binary);
+    if (!in || !in.seekg(static_cast<std::streamoff>(from))) return false;
+    char buffer[1 << 16];
+    std::uintmax_t remaining = to - from;
+    while (remaining > 0) {
+        std::streamsize chunk = static_cast<std::streamsize>(remaining < sizeof(buffer) ? remaining : sizeof(buffer));
+        if (!in.read(buffer, chunk)) return false;
+        hash = extendHash(hash, std::string_view(buffer, static_cast<std::size_t>(chunk)));
+        remaining -= static_cast<std::uintmax_t>(chunk);
+    }
+    return true;
+}
+
+// Size, mtime and (on POSIX) inode; AtomicFile's rename gives every rewrite a
+// new inode, which catches same-size rewrites within one mtime tick
+static void statFile(const std::string& path, bool& exists, std::uintmax_t& size, std::uintmax_t& inode,
+                     std::filesystem::file_time_type& modified) {
+    std::error_code ec;
+    size = std::filesystem::file_size(path, ec);
+    exists = !ec;
+    if (exists) modified = std::filesystem::last_write_time(path, ec);
+    if (ec) {
+        exists = false;
+        size = 0;
+    }
+    inode = 0;
+#ifndef _WIN32
+    struct stat info;
+    if (exists && ::stat(path.c_str(), &info) == 0) inode = static_cast<std::uintmax_t>(info.st_ino);
+#endif
+}
+
+// Hash of the last tail bytes before offset; false if they are not all there
+static bool hashJournalTail(const std::string& journal, std::uintmax_t offset, std::uintmax_t tail, std::uint64_t& hash) {
+    hash = HASH_BASIS;
+    return extendHashFromFile(journal, offset > tail ? offset - tail : 0, offset, hash);
+}
+
+// Shared inotify instance with one watch per directory. Every event bumps a
+// generation counter for the data file it concerns ("<file>.journal" counts
+// as "<file>"); a watch whose generation has not moved needs no stat.
+class ChangeNotifier {
+public:
+    static ChangeNotifier& instance() {
+        // Never destroyed: managers may check files while statics are torn down
+        static ChangeNotifier* notifier = new ChangeNotifier();
+        return *notifier;
+    }
+
+    bool isActive() const {
+        return fd >= 0;
+    }
+
+    // Current generation of filename; false if it cannot be watched
+    bool generationOf(const std::string& filename, unsigned long long& generation) {
+#ifdef __linux__
+        if (fd < 0) return false;
+        std::lock_guard<std::mutex> lock(mutex);
+        std::filesystem::path path(filename);
+        std::string directory = path.parent_path().string();
+        if (directory.empty()) directory = ".";
+        if (!watchedDirectories.contains(directory)) {
+            int wd = inotify_add_watch(fd, directory.c_str(),
+                                       IN_MODIFY | IN_ATTRIB | IN_CLOSE_WRITE | IN_MOVED_FROM | IN_MOVED_TO |
+                                       IN_CREATE | IN_DELETE | IN_DELETE_SELF | IN_MOVE_SELF);
+            if (wd < 0) return false;
+            watchedDirectories[directory] = wd;
+            directories[wd] = directory;
+        }
+        drainEvents();
+        std::string key = directory + "/" + path.filename().string();
+        unsigned long long* found = generations.find(key);
+        generation = found && *found > everything ? *found : everything;
+        return true;
+#else
+        (void)filename;
+        (void)generation;
+        return false;
+#endif
+    }
+
+private:
+    std::mutex mutex;
+    int fd;
+    HashMap<std::string, int> watchedDirectories;
+    HashMap<int, std::string> directories;
+    HashMap<std::string, unsigned long long> generations;
+    unsigned long long clock;
+    unsigned long long everything;  // Generation of the last event that may affect any file
+
+    ChangeNotifier() : fd(-1), clock(0), everything(0) {
+#ifdef __linux__
+        fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+#endif
+    }
+
+#ifdef __linux__
+    // Called with mutex held
+    void drainEvents() {
+        alignas(inotify_event) char buffer[16 * (sizeof(inotify_event) + NAME_MAX + 1)];
+        while (true) {
+            ssize_t length = ::read(fd, buffer, sizeof(buffer));
+            if (length <= 0) {
+                if (length < 0 && errno == EINTR) continue;
+                return;
+            }
+            for (char* at = buffer; at < buffer + length; ) {
+                const inotify_event* event = reinterpret_cast<const inotify_event*>(at);
+                at += sizeof(inotify_event) + event->len;
+                handle(*event);
+            }
+        }
+    }
+
+    void handle(const inotify_event& event) {
+        clock++;
+        if (event.mask & (IN_Q_OVERFLOW | IN_DELETE_SELF | IN_MOVE_SELF | IN_IGNORED)) {
+            everything = clock;
+            if (event.mask & IN_IGNORED) forget(event.wd);
+            return;
+        }
+        const std::string* directory = directories.find(event.wd);
+        if (!directory || event.len == 0) return;
+
+        std::string name(event.name);
+        const std::string journalSuffix = ".journal";
+        if (name.size() > journalSuffix.size() &&
+            name.compare(name.size() - journalSuffix.size(), journalSuffix.size(), journalSuffix) == 0) {
+            name.erase(name.size() - journalSuffix.size());
+        }
+        generations[*directory + "/" + name] = clock;
+    }
+
+    // The directory went away; watch it again on the next check
+    void forget(int wd) {
+        const std::string* directory = directories.find(wd);
+        if (!directory) return;
+        watchedDirectories.erase(*directory);
+        directories.erase(wd);
+    }
+#endif
+};
+
+FileWatch::FileWatch(const std::string& filename) : filename(filename) {}
+
+const std::string& FileWatch::getFilename() const {
+    return filename;
+}
+
+bool FileWatch::isNotifying() {
+    return ChangeNotifier::instance().isActive();
+}
+
+std::uintmax_t FileWatch::getJournalOffset() const {
+    return observed.journalOffset;
+}
+
+void FileWatch::invalidate() {
+    current = State();
+}
+
+FileWatch::Change FileWatch::check() {
+    // Our own saves may still be in memory; they count as changes too
+    WriteBehindCache::instance().flush(filename);
+
+    unsigned long long generation = 0;
+    bool notified = ChangeNotifier::instance().generationOf(filename, generation);
+    if (current.valid && notified && generation == current.generation) return Change::None;
+
+    observed = current;
+    observed.generation = generation;
+    statFile(filename, observed.exists, observed.size, observed.inode, observed.modified);
+
+    bool touched = false;
+    bool sameSnapshot = current.valid && observed.exists == current.exists;
+    if (sameSnapshot && observed.exists &&
+        (observed.size != current.size || observed.inode != current.inode || observed.modified != current.modified)) {
+        // Rewritten: unchanged only if the content is identical
+        observed.hash = observed.size == current.size ? hashFile(filename) : 0;
+        sameSnapshot = observed.size == current.size && observed.hash == current.hash;
+        touched = true;
+    }
+    if (!sameSnapshot) {
+        if (observed.exists && !(touched && observed.size == current.size)) observed.hash = hashFile(filename);
+        observed.journalOffset = 0;
+        return Change::Replaced;
+    }
+
+    // Same snapshot: the journal must be the one read, only grown since.
+    // JsonJournal only ever appends to it, so the same inode ending in the
+    // same bytes at the applied offset is taken as the same prefix.
+    std::string journal = JsonJournal::journalPath(filename);
+    bool journalExists;
+    std::uintmax_t size, inode;
+    std::filesystem::file_time_type journalModified;
+    statFile(journal, journalExists, size, inode, journalModified);
+    if (size < current.journalOffset) {
+        observed.journalOffset = 0;
+        return Change::Replaced;
+    }
+    if (size > current.journalOffset || touched) {
+        std::uint64_t tailHash;
+        if (current.journalOffset > 0 &&
+            (inode != current.journalInode ||
+             !hashJournalTail(journal, current.journalOffset, JOURNAL_TAIL, tailHash) ||
+             tailHash != current.journalTailHash)) {
+            observed.journalOffset = 0;
+            return Change::Replaced;
+        }
+        if (size > current.journalOffset) return Change::Appended;
+    }
+    current = observed;
+    return Change::None;
+}
+
+bool FileWatch::getStamp(Stamp& stamp) const {
+    if (!current.valid) return false;
+    stamp.size = current.size;
+    stamp.hash = current.hash;
+    stamp.journalOffset = current.journalOffset;
+    stamp.journalInode = current.journalInode;
+    stamp.journalTailHash = current.journalTailHash;
+    return true;
+}
+
+bool FileWatch::startsWith(const Stamp& stamp) const {
+    Stamp loaded;
+    if (!getStamp(loaded) || loaded.size != stamp.size || loaded.hash != stamp.hash ||
+        loaded.journalOffset < stamp.journalOffset) {
+        return false;
+    }
+    if (stamp.journalOffset == 0) return true;
+    if (loaded.journalInode != stamp.journalInode) return false;
+    if (loaded.journalOffset == stamp.journalOffset) return loaded.journalTailHash == stamp.journalTailHash;
+
+    // Same journal, grown since: the stamped bytes must still end the prefix
+    std::uint64_t tailHash;
+    return hashJournalTail(JsonJournal::journalPath(filename), stamp.journalOffset, JOURNAL_TAIL, tailHash) &&
+           tailHash == stamp.journalTailHash;
+}
+
+void FileWatch::loaded(std::uintmax_t journalOffset) {
+    std::string journal = JsonJournal::journalPath(filename);
+    bool journalExists;
+    std::uintmax_t size;
+    std::filesystem::file_time_type journalModified;
+    statFile(journal, journalExists, size, observed.journalInode, journalModified);
+    if (journalOffset < observed.journalOffset ||
+        !hashJournalTail(journal, journalOffset, JOURNAL_TAIL, observed.journalTailHash)) {
+        // Cannot vouch for the journal prefix; reload in full next time
+        current = State();
+        return;
+    }
+    observed.journalOffset = journalOffset;
+    observed.valid = true;
+    current = observed;
+}
@@ -0,0 +1,223 @@
+#include "helper/GroupCommit.hpp"
+#include "helper/JsonJournal.hpp"
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+
+using json = nlohmann::json;
+
+GroupCommit& GroupCommit::instance() {
+    // Never destroyed: global objects may still save while statics are torn
+    // down. The atexit hook commits what is pending before that happens.
+    static GroupCommit* commit = [] {
+        GroupCommit* created = new GroupCommit();
+        std::atexit([] { GroupCommit::instance().shutdown(); });
+        return created;
+    }();
+    return *commit;
+}
+
+GroupCommit::GroupCommit()
+    : window(5), stopping(false), running(false), submitted(0), commits(0), failures(0) {}
+
+void GroupCommit::setWindow(std::chrono::milliseconds newWindow) {
+    std::lock_guard<std::mutex> lock(stateMutex);
+    window = newWindow.count() < 0 ? std::chrono::milliseconds(0) : newWindow;
+}
+
+std::chrono::milliseconds GroupCommit::getWindow() const {
+    std::lock_guard<std::mutex> lock(stateMutex);
+    return window;
+}
+
+void GroupCommit::submitSnapshot(const std::string& filename, Build build, Completion done) {
+    bool synchronous;
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        PendingWrite& entry = pending[filename];
+        entry.hasSnapshot = true;
+        entry.build = std::move(build);
+        entry.snapshot.clear();
+        entry.snapshotDone = std::move(done);
+        entry.appends.clear();      // Superseded by the new snapshot
+        submitted++;
+        synchronous = stopping || window.count() == 0;
+        if (!synchronous && !running) {
+            running = true;
+            worker = std::thread(&GroupCommit::run, this);
+        }
+    }
+    if (synchronous) commitFile(filename);
+    else wakeUp.notify_one();
+}
+
+void GroupCommit::submitAppend(const std::string& filename, json record) {
+    bool synchronous;
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        pending[filename].appends.push_back(std::move(record));
+        submitted++;
+        synchronous = stopping || window.count() == 0;
+        if (!synchronous && !running) {
+            running = true;
+            worker = std::thread(&GroupCommit::run, this);
+        }
+    }
+    if (synchronous) commitFile(filename);
+    else wakeUp.notify_one();
+}
+
+bool GroupCommit::flush() {
+    bool ok = commitAll();
+    std::lock_guard<std::mutex> lock(stateMutex);
+    if (!failed.isEmpty()) {
+        failed.clear();
+        ok = false;
+    }
+    return ok;
+}
+
+bool GroupCommit::flush(const std::string& filename) {
+    bool ok = commitFile(filename);
+    std::lock_guard<std::mutex> lock(stateMutex);
+    if (failed.erase(filename)) ok = false;
+    return ok;
+}
+
+void GroupCommit::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        stopping = true;
+    }
+    wakeUp.notify_all();
+    if (worker.joinable()) worker.join();
+    flush();
+}
+
+DynamicArray<std::string> GroupCommit::takeUnreportedFailures() {
+    DynamicArray<std::string> files;
+    std::lock_guard<std::mutex> lock(stateMutex);
+    unreported.forEach([&files](const std::string& filename) { files.push_back(filename); });
+    unreported.clear();
+    return files;
+}
+
+long long GroupCommit::getSubmittedCount() const {
+    std::lock_guard<std::mutex> lock(stateMutex);
+    return submitted;
+}
+
+long long GroupCommit::getCommitCount() const {
+    std::lock_guard<std::mutex> lock(stateMutex);
+    return commits;
+}
+
+long long GroupCommit::getFailureCount() const {
+    std::lock_guard<std::mutex> lock(stateMutex);
+    return failures;
+}
+
+void GroupCommit::run() {
+    std::unique_lock<std::mutex> lock(stateMutex);
+    while (true) {
+        wakeUp.wait(lock, [this] { return stopping || !pending.isEmpty(); });
+        if (stopping) break;    // shutdown() commits whatever is left
+
+        // Let the rest of the burst arrive before committing
+        wakeUp.wait_for(lock, window, [this] { return stopping; });
+        if (stopping) break;
+
+        // Failures stay recorded for the next caller that flushes. Failed
+        // writes are queued again; wait a while before retrying them.
+        lock.unlock();
+        bool ok = commitAll();
+        lock.lock();
+        if (!ok) wakeUp.wait_for(lock, RETRY_DELAY, [this] { return stopping; });
+    }
+}
+
+bool GroupCommit::commitAll() {
+    std::lock_guard<std::mutex> commitLock(commitMutex);
+    HashMap<std::string, PendingWrite> batch;
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        batch.swap(pending);
+    }
+    return commitPending(batch);
+}
+
+bool GroupCommit::commitFile(const std::string& filename) {
+    // Taking commitMutex also waits out a commit of this file already in flight
+    std::lock_guard<std::mutex> commitLock(commitMutex);
+    PendingWrite write;
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        PendingWrite* found = pending.find(filename);
+        if (!found) return true;
+        write = std::move(*found);
+        pending.erase(filename);
+    }
+    return commitFile(filename, write);
+}
+
+bool GroupCommit::commitPending(HashMap<std::string, PendingWrite>& batch) {
+    bool ok = true;
+    batch.forEach([this, &ok](const std::string& filename, PendingWrite& write) {
+        if (!commitFile(filename, write)) ok = false;
+    });
+    return ok;
+}
+
+bool GroupCommit::commitFile(const std::string& filename, PendingWrite& write) {
+    bool ok = true;
+    bool snapshotWritten = false;
+    try {
+        if (write.build) {
+            // Built only now, after every earlier write to the file; a build
+            // that throws leaves no snapshot behind
+            Build build = std::move(write.build);
+            write.build = nullptr;
+            write.hasSnapshot = false;
+            write.hasSnapshot = build(write.snapshot);
+            if (!write.hasSnapshot && write.appends.empty()) return true;
+        }
+        if (write.hasSnapshot) {
+            // Swaps in the snapshot and retires the journal it supersedes
+            ok = snapshotWritten = JsonJournal::replaceSnapshot(filename, write.snapshot);
+        }
+        if (ok && !write.appends.empty()) {
+            ok = JsonJournal::appendBatch(filename, write.appends);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Failed to commit " << filename << ": " << e.what() << std::endl;
+        ok = false;
+    }
+    if (!ok) {
+        std::cerr << "Pending writes to " << filename << " were not saved; retrying" << std::endl;
+    }
+    if (write.hasSnapshot && write.snapshotDone) write.snapshotDone(snapshotWritten);
+
+    std::lock_guard<std::mutex> lock(stateMutex);
+    commits++;
+    if (ok) {
+        failed.erase(filename);
+        unreported.erase(filename);
+        return true;
+    }
+    failed.insert(filename);
+    unreported.insert(filename);
+    failures++;
+
+    // Callers were told these writes were accepted, so they go back to the
+    // front of the queue instead of being dropped. A snapshot submitted in
+    // the meantime replaces all of them.
+    PendingWrite& retry = pending[filename];
+    if (retry.hasSnapshot) return false;
+    if (write.hasSnapshot && !snapshotWritten) {
+        retry.hasSnapshot = true;
+        retry.snapshot = std::move(write.snapshot);
+    }
+    write.appends.append(std::move(retry.appends));
+    retry.appends = std::move(write.appends);
+    return false;
+}
@@ -0,0 +1,238 @@
+#include "helper/JsonJournal.hpp"
+#include "helper/SnapshotFile.hpp"
+#include "helper/AtomicFile.hpp"
+#include "structures/HashMap.hpp"
+#include "structures/HashSet.hpp"
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+
+using json = nlohmann::json;
+
+// Per-file bookkeeping, filled in from disk the first time a file is touched
+struct JournalState {
+    bool recovered = false;
+    bool initialised = false;
+    std::uintmax_t snapshotBytes = 0;
+    std::uintmax_t journalBytes = 0;
+    int journalRecords = 0;
+    bool idsLoaded = false;
+    HashSet<std::string> ids;
+};
+
+// Intentionally leaked: GroupCommit still appends from its atexit hook, which
+// may run after function-local statics have been destroyed
+static std::mutex& journalMutex() {
+    static std::mutex* mutex = new std::mutex();
+    return *mutex;
+}
+
+static HashMap<std::string, JournalState>& journalStates() {
+    static HashMap<std::string, JournalState>* states = new HashMap<std::string, JournalState>();
+    return *states;
+}
+
+static std::uintmax_t sizeOrZero(const std::string& path) {
+    std::error_code ec;
+    std::uintmax_t size = std::filesystem::file_size(path, ec);
+    return ec ? 0 : size;
+}
+
+static bool pathExists(const std::string& path) {
+    std::error_code ec;
+    return std::filesystem::exists(path, ec);
+}
+
+static void recoverLocked(const std::string& filename, JournalState& state) {
+    if (state.recovered) return;
+    state.recovered = true;
+
+    std::string retired = JsonJournal::retiredJournalPath(filename);
+    if (!pathExists(retired)) return;
+
+    std::error_code ec;
+    std::string temp = AtomicFile::tempPath(filename);
+    if (pathExists(temp)) {
+        // Stopped before the new snapshot was renamed in: the old snapshot
+        // is live and still needs its journal
+        std::cerr << "Restoring the journal of " << filename << " after an interrupted save" << std::endl;
+        AtomicFile::rename(retired, JsonJournal::journalPath(filename));
+        std::filesystem::remove(temp, ec);
+    } else {
+        // The new snapshot is in place and already holds these records
+        std::filesystem::remove(retired, ec);
+    }
+}
+
+static JournalState& stateFor(const std::string& filename) {
+    JournalState& state = journalStates()[filename];
+    recoverLocked(filename, state);
+    if (!state.initialised) {
+        std::string journal = JsonJournal::journalPath(filename);
+        state.snapshotBytes = sizeOrZero(filename);
+        state.journalBytes = sizeOrZero(journal);
+        state.journalRecords = 0;
+        std::ifstream in(journal);
+        std::string line;
+        while (std::getline(in, line)) {
+            if (!line.empty()) state.journalRecords++;
+        }
+        state.initialised = true;
+    }
+    return state;
+}
+
+static void replayLocked(const std::string& filename, json& data) {
+    if (!data.is_array()) data = json::array();
+    std::ifstream in(JsonJournal::journalPath(filename));
+    if (!in.is_open()) return;
+
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.empty()) continue;
+        json record = json::parse(line, nullptr, false);
+        if (record.is_discarded()) continue;
+        data.push_back(std::move(record));
+    }
+}
+
+// The single place a snapshot is swapped together with its journal; see
+// the header for the order of steps and how a crash between them is undone
+static bool replaceSnapshotLocked(const std::string& filename, JournalState& state, const std::string& bytes) {
+    if (!AtomicFile::writeTemp(filename, bytes)) return false;
+
+    std::string journal = JsonJournal::journalPath(filename);
+    std::string retired = JsonJournal::retiredJournalPath(filename);
+    std::error_code ec;
+    bool hadJournal = pathExists(journal);
+    if (hadJournal && !AtomicFile::rename(journal, retired)) {
+        std::filesystem::remove(AtomicFile::tempPath(filename), ec);
+        return false;
+    }
+    if (!AtomicFile::commitTemp(filename)) {
+        if (hadJournal) AtomicFile::rename(retired, journal);
+        return false;
+    }
+    std::filesystem::remove(retired, ec);
+
+    state.snapshotBytes = bytes.size();
+    state.journalBytes = 0;
+    state.journalRecords = 0;
+    return true;
+}
+
+static bool compactLocked(const std::string& filename, JournalState& state) {
+    json data = json::array();
+    if (std::filesystem::exists(filename) && !SnapshotFile::read(filename, data)) {
+        std::cerr << "Journal compaction skipped: cannot parse " << filename << std::endl;
+        return false;
+    }
+    replayLocked(filename, data);
+
+    if (!replaceSnapshotLocked(filename, state, SnapshotFile::encode(data, SnapshotFile::getFormat()))) {
+        std::cerr << "Journal compaction failed to write " << filename << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// One write + fsync for the whole batch
+static bool appendLocked(const std::string& filename, JournalState& state, const json* records, int count) {
+    std::string lines;
+    for (int i = 0; i < count; i++) {
+        lines += records[i].dump();
+        lines += '\n';
+    }
+    if (!AtomicFile::append(JsonJournal::journalPath(filename), lines)) {
+        std::cerr << "Failed to write journal for " << filename << std::endl;
+        return false;
+    }
+
+    state.journalBytes += lines.size();
+    state.journalRecords += count;
+    if (state.idsLoaded) {
+        for (int i = 0; i < count; i++) {
+            const json& record = records[i];
+            if (record.contains("id") && record["id"].is_string()) {
+                state.ids.insert(record["id"].get<std::string>());
+            }
+        }
+    }
+
+    if (state.journalRecords >= JsonJournal::COMPACT_MIN_RECORDS && state.journalBytes >= state.snapshotBytes) {
+        compactLocked(filename, state);
+    }
+    return true;
+}
+
+std::string JsonJournal::journalPath(const std::string& filename) {
+    return filename + ".journal";
+}
+
+std::string JsonJournal::retiredJournalPath(const std::string& filename) {
+    return filename + ".journal.old";
+}
+
+bool JsonJournal::append(const std::string& filename, const json& record) {
+    std::lock_guard<std::mutex> lock(journalMutex());
+    return appendLocked(filename, stateFor(filename), &record, 1);
+}
+
+bool JsonJournal::appendBatch(const std::string& filename, const DynamicArray<json>& records) {
+    if (records.empty()) return true;
+    std::lock_guard<std::mutex> lock(journalMutex());
+    return appendLocked(filename, stateFor(filename), records.begin(), records.getSize());
+}
+
+void JsonJournal::replay(const std::string& filename, json& data) {
+    std::lock_guard<std::mutex> lock(journalMutex());
+    recoverLocked(filename, journalStates()[filename]);
+    replayLocked(filename, data);
+}
+
+bool JsonJournal::compact(const std::string& filename) {
+    std::lock_guard<std::mutex> lock(journalMutex());
+    JournalState& state = stateFor(filename);
+    if (state.journalRecords == 0) return true;
+    return compactLocked(filename, state);
+}
+
+bool JsonJournal::replaceSnapshot(const std::string& filename, const std::string& bytes) {
+    std::lock_guard<std::mutex> lock(journalMutex());
+    JournalState& state = stateFor(filename);
+    if (!replaceSnapshotLocked(filename, state, bytes)) return false;
+
+    // The new contents may hold any ids; reload them on next use
+    state.idsLoaded = false;
+    state.ids.clear();
+    return true;
+}
+
+void JsonJournal::recover(const std::string& filename) {
+    std::lock_guard<std::mutex> lock(journalMutex());
+    recoverLocked(filename, journalStates()[filename]);
+}
+
+bool JsonJournal::containsId(const std::string& filename, const std::string& id) {
+    std::lock_guard<std::mutex> lock(journalMutex());
+    JournalState& state = stateFor(filename);
+    if (!state.idsLoaded) {
+        json data = json::array();
+        if (!SnapshotFile::read(filename, data)) data = json::array();
+        replayLocked(filename, data);
+        for (const auto& item : data) {
+            if (item.is_object() && item.contains("id") && item["id"].is_string()) {
+                state.ids.insert(item["id"].get<std::string>());
+            }
+        }
+        state.idsLoaded = true;
+    }
+    return state.ids.contains(id);
+}
+
+int JsonJournal::pendingRecords(const std::string& filename) {
+    std::lock_guard<std::mutex> lock(journalMutex());
+    return stateFor(filename).journalRecords;
+}
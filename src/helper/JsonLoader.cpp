@@ -1,223 +1,258 @@
 #include "helper/JsonLoader.hpp"
-#include <fstream>
-#include <nlohmann/json.hpp>
-
-using json = nlohmann::json;
-
-DoublyLinkedList<Player> JsonLoader::loadPlayers(const std::string& filename) {
-    DoublyLinkedList<Player> list;
-    std::ifstream file(filename);
-    if (!file.is_open()) return list;
-
-    json data;
-    file >> data;
-
-    for (const auto& item : data) {
-        // Parse Gender
-        Gender gender = item["gender"] == "Male" ? Gender::Male : Gender::Female;
-
-        Player player(
-            item["id"],
-            item["name"],
-            item["age"],
-            gender,
-            item["email"],
-            item["phoneNum"],
-            item["points"],
-            item["isEarlyBird"],
-            item["isWildcard"],
-            item["isLate"],
-            item["dateJoined"]
-        );
+#include "helper/DtoCodec.hpp"
+#include "helper/WriteBehindCache.hpp"
+#include "helper/JsonJournal.hpp"
+#include "helper/MappedFile.hpp"
+#include <filesystem>
+#include <iostream>
+#include <mutex>
+#include "structures/HashMap.hpp"
 
-        std::cout << "Loaded player: " << player.name << " (ID: " << player.id << ")" << std::endl;
-        list.append(player);
+// Every loader maps the snapshot (JSON or binary, see SnapshotFile) and runs
+// a SAX handler over the mapped bytes straight into the DTO list (no iostream
+// copy, no intermediate json tree), then decodes the journal lines the same
+// way. Saves still waiting in WriteBehindCache/GroupCommit are written first.
+
+// Size and mtime of a snapshot and its journal, taken before a prefetch
+// parses them. A prefetched copy is only handed out while they still match.
+struct FileStamp {
+    bool exists = false;
+    std::uintmax_t size = 0;
+    std::filesystem::file_time_type modified;
+    bool journalExists = false;
+    std::uintmax_t journalSize = 0;
+    std::filesystem::file_time_type journalModified;
+
+    bool operator==(const FileStamp& other) const {
+        return exists == other.exists && size == other.size && modified == other.modified &&
+               journalExists == other.journalExists && journalSize == other.journalSize &&
+               journalModified == other.journalModified;
+    }
+};
+
+static void stampPath(const std::string& path, bool& exists, std::uintmax_t& size, std::filesystem::file_time_type& modified) {
+    std::error_code ec;
+    size = std::filesystem::file_size(path, ec);
+    exists = !ec;
+    if (exists) modified = std::filesystem::last_write_time(path, ec);
+    if (ec) {
+        exists = false;
+        size = 0;
     }
+}
+
+static FileStamp stampOf(const std::string& filename) {
+    FileStamp stamp;
+    stampPath(filename, stamp.exists, stamp.size, stamp.modified);
+    stampPath(JsonJournal::journalPath(filename), stamp.journalExists, stamp.journalSize, stamp.journalModified);
+    return stamp;
+}
+
+template <typename V>
+struct Prefetched {
+    FileStamp stamp;
+    V value;
+    std::uintmax_t journalEnd = 0;
+};
+
+static std::mutex prefetchMutex;
+
+template <typename V>
+static HashMap<std::string, Prefetched<V>>& prefetchedOf() {
+    static HashMap<std::string, Prefetched<V>> entries;
+    return entries;
+}
+
+// Copy a still-valid prefetched value into out
+template <typename V>
+static bool takePrefetched(const std::string& filename, V& out, std::uintmax_t& journalEnd) {
+    FileStamp stamp = stampOf(filename);
+    std::lock_guard<std::mutex> lock(prefetchMutex);
+    Prefetched<V>* found = prefetchedOf<V>().find(filename);
+    if (!found || !(found->stamp == stamp)) return false;
+    out = found->value;
+    journalEnd = found->journalEnd;
+    return true;
+}
+
+template <typename V>
+static void storePrefetched(const std::string& filename, const FileStamp& stamp, V&& value, std::uintmax_t journalEnd) {
+    std::lock_guard<std::mutex> lock(prefetchMutex);
+    Prefetched<V>& entry = prefetchedOf<V>()[filename];
+    entry.stamp = stamp;
+    entry.value = std::move(value);
+    entry.journalEnd = journalEnd;
+}
+
+// Decode the journal records from journalOffset on, advancing it past them
+template <typename T, typename Sink>
+static void parseJournal(const std::string& filename, std::uintmax_t& journalOffset, Sink&& sink) {
+    journalOffset = JsonJournal::forEachLineFrom(filename, journalOffset, [&sink](const std::string& line) {
+        DtoCodec::readRecord<T>(line, sink);
+    });
+}
+
+template <typename T>
+static DoublyLinkedList<T> parseList(const std::string& filename, std::uintmax_t& journalEnd) {
+    DoublyLinkedList<T> list;
+    journalEnd = 0;
+    MappedFile file(filename);
+    if (!file.isOpen()) return list;
+
+    auto append = [&list](T&& record) { list.append(std::move(record)); };
+    DtoCodec::readBuffer<T>(file.view(), append);
+    parseJournal<T>(filename, journalEnd, append);
     return list;
 }
 
-PriorityQueue<Player> JsonLoader::loadCheckedInPlayers(const std::string& filename) {
-    PriorityQueue<Player> queue;
-    std::ifstream file(filename);
-    if (!file.is_open()) return queue;
-
-    json data;
-    file >> data;
-    for (const auto& item : data) {
-        Player player(
-            item["id"],
-            item["name"],
-            item["age"],
-            item["gender"] == "Male" ? Gender::Male : Gender::Female,
-            item["email"],
-            item["phoneNum"],
-            item["points"],
-            item["isEarlyBird"],
-            item["isWildcard"],
-            item["isLate"],
-            item["dateJoined"]
-        );
-        queue.enqueue(player, item["priority"]);
-    }
+static CheckInQueue parseCheckedIn(const std::string& filename, std::uintmax_t& journalEnd) {
+    CheckInQueue queue;
+    journalEnd = 0;
+    MappedFile file(filename);
+    if (!file.isOpen()) return queue;
+
+    // Collect everything first, then heapify in one pass
+    DynamicArray<Player> players;
+    DynamicArray<int> priorities;
+    auto collect = [&players, &priorities](CheckedInRecord&& record) {
+        players.push_back(std::move(record.player));
+        priorities.push_back(record.priority);
+    };
+    DtoCodec::readBuffer<CheckedInRecord>(file.view(), collect);
+    parseJournal<CheckedInRecord>(filename, journalEnd, collect);
+    queue.assign(std::move(players), priorities);
     return queue;
 }
 
-DoublyLinkedList<Match> JsonLoader::loadMatches(const std::string& filename) {
-    DoublyLinkedList<Match> list;
-    std::ifstream file(filename);
-    if (!file.is_open()) return list;
-
-    json data;
-    file >> data;
-
-    for (const auto& item : data) {
-        // Parse TournamentStage from string
-        TournamentStage stage = TournamentStage::Qualifiers;
-        std::string stageStr = item["stage"];
-        if (stageStr == "Registration") stage = TournamentStage::Registration;
-        else if (stageStr == "Qualifiers") stage = TournamentStage::Qualifiers;
-        else if (stageStr == "Tiebreakers") stage = TournamentStage::Tiebreakers;
-        else if (stageStr == "Quarterfinals") stage = TournamentStage::Quarterfinals;
-        else if (stageStr == "Semifinals") stage = TournamentStage::Semifinals;
-        else if (stageStr == "Finals") stage = TournamentStage::Finals;
-
-        Match match(
-            item["id"],
-            item["tournamentId"],
-            stage,
-            item["date"],
-            item["time"],
-            item["player1"],
-            item["player2"]
-        );
-        list.append(match);
-    }
+template <typename T>
+static DoublyLinkedList<T> loadList(const std::string& filename, std::uintmax_t* journalEnd = nullptr) {
+    WriteBehindCache::instance().flush(filename);
+    DoublyLinkedList<T> list;
+    std::uintmax_t end = 0;
+    if (!takePrefetched(filename, list, end)) list = parseList<T>(filename, end);
+    if (journalEnd) *journalEnd = end;
     return list;
 }
 
-DoublyLinkedList<Performance> JsonLoader::loadPerformances(const std::string& filename) {
-    DoublyLinkedList<Performance> list;
-    std::ifstream file(filename);
-    if (!file.is_open()) return list;
-
-    json data;
-    file >> data;
-
-    for (const auto& item : data) {
-        Performance perf(
-            item["playerId"],
-            item["matchPlayed"],
-            item["favouriteChampion"],
-            item["lastWin"],
-            item["winRate"]
-        );
-        list.append(perf);
+template <typename T>
+static DoublyLinkedList<T> loadAppended(const std::string& filename, std::uintmax_t& journalOffset) {
+    WriteBehindCache::instance().flush(filename);
+    DoublyLinkedList<T> list;
+    parseJournal<T>(filename, journalOffset, [&list](T&& record) { list.append(std::move(record)); });
+    return list;
+}
+
+template <typename T>
+static void prefetchList(const std::string& filename) {
+    WriteBehindCache::instance().flush(filename);
+    FileStamp stamp = stampOf(filename);
+    if (!stamp.exists) return;
+    std::uintmax_t journalEnd;
+    DoublyLinkedList<T> list = parseList<T>(filename, journalEnd);
+    storePrefetched(filename, stamp, std::move(list), journalEnd);
+}
+
+static void printLoadedPlayers(const DoublyLinkedList<Player>& list) {
+    for (const Player& player : list) {
+        std::cout << "Loaded player: " << player.name << " (ID: " << player.id << ")" << std::endl;
     }
+}
+
+DoublyLinkedList<Player> JsonLoader::loadPlayers(const std::string& filename, std::uintmax_t* journalEnd) {
+    DoublyLinkedList<Player> list = loadList<Player>(filename, journalEnd);
+    printLoadedPlayers(list);
+    return list;
+}
+
+DoublyLinkedList<Player> JsonLoader::loadAppendedPlayers(const std::string& filename, std::uintmax_t& journalOffset) {
+    DoublyLinkedList<Player> list = loadAppended<Player>(filename, journalOffset);
+    printLoadedPlayers(list);
     return list;
 }
 
-DoublyLinkedList<Result> JsonLoader::loadResults(const std::string& filename) {
-    DoublyLinkedList<Result> list;
-    std::ifstream file(filename);
-    if (!file.is_open()) return list;
+DoublyLinkedList<Player> JsonLoader::readPlayers(const std::string& filename, std::uintmax_t* journalEnd) {
+    return loadList<Player>(filename, journalEnd);
+}
 
-    json data;
-    file >> data;
+DoublyLinkedList<Player> JsonLoader::readAppendedPlayers(const std::string& filename, std::uintmax_t& journalOffset) {
+    return loadAppended<Player>(filename, journalOffset);
+}
 
-    for (const auto& item : data) {
-        Champion champP1 = championFromString(item["championsP1"]);
-        Champion champP2 = championFromString(item["championsP2"]);
+CheckInQueue JsonLoader::loadCheckedInPlayers(const std::string& filename) {
+    WriteBehindCache::instance().flush(filename);
+    CheckInQueue queue;
+    std::uintmax_t journalEnd;
+    if (takePrefetched(filename, queue, journalEnd)) return queue;
+    return parseCheckedIn(filename, journalEnd);
+}
 
-        Result result(
-            item["id"].get<std::string>(),
-            item["matchId"].get<std::string>(),
-            champP1,
-            champP2,
-            item["winnerId"].get<std::string>()
-        );
-        list.append(result);
-    }
+DoublyLinkedList<Match> JsonLoader::loadMatches(const std::string& filename, std::uintmax_t* journalEnd) {
+    return loadList<Match>(filename, journalEnd);
+}
 
-    return list;
+DoublyLinkedList<Match> JsonLoader::loadAppendedMatches(const std::string& filename, std::uintmax_t& journalOffset) {
+    return loadAppended<Match>(filename, journalOffset);
+}
+
+DoublyLinkedList<Performance> JsonLoader::loadPerformances(const std::string& filename) {
+    return loadList<Performance>(filename);
+}
+
+DoublyLinkedList<Result> JsonLoader::loadResults(const std::string& filename, std::uintmax_t* journalEnd) {
+    return loadList<Result>(filename, journalEnd);
+}
+
+DoublyLinkedList<Result> JsonLoader::loadAppendedResults(const std::string& filename, std::uintmax_t& journalOffset) {
+    return loadAppended<Result>(filename, journalOffset);
 }
 
 DoublyLinkedList<Spectator> JsonLoader::loadSpectators(const std::string& filename) {
-    DoublyLinkedList<Spectator> list;
-    std::ifstream file(filename);
-    if (!file.is_open()) return list;
-
-    json data;
-    file >> data;
-
-    for (const auto& item : data) {
-        // Parse SpectatorType from string
-        SpectatorType type = SpectatorType::Normal;
-        std::string typeStr = item["type"];
-        if (typeStr == "VIP") type = SpectatorType::VIP;
-        else if (typeStr == "Streamer") type = SpectatorType::Streamer;
-        else if (typeStr == "Influencer") type = SpectatorType::Influencer;
-        else if (typeStr == "Player") type = SpectatorType::Player;
-
-        // Parse ID from string format "S00001" to integer
-        std::string idStr = item["id"];
-        int id = 0;
-        if (idStr.length() > 1 && idStr[0] == 'S') {
-            id = std::stoi(idStr.substr(1)); // Remove 'S' prefix and convert to int
-        }
-        
-        Spectator spec(
-            id,
-            item["name"],
-            item["gender"] == "Male" ? Gender::Male : Gender::Female,
-            item["email"],
-            item["phoneNum"],
-            type,
-            item["affiliation"]
-        );
-        list.append(spec);
-    }
-    return list;
+    return loadList<Spectator>(filename);
 }
 
-DoublyLinkedList<Tournament> JsonLoader::loadTournaments(const std::string& filename) {
-    DoublyLinkedList<Tournament> list;
-    std::ifstream file(filename);
-    if (!file.is_open()) return list;
-
-    json data;
-    file >> data;
-
-    for (const auto& item : data) {
-        // Parse TournamentCategory from string
-        TournamentCategory category = TournamentCategory::Local;
-        std::string categoryStr = item["category"];
-        if (categoryStr == "Regional") category = TournamentCategory::Regional;
-        else if (categoryStr == "International") category = TournamentCategory::International;
-
-        // Parse TournamentStage from string
-        TournamentStage stage = TournamentStage::Qualifiers;
-        std::string stageStr = item["stage"];
-        if (stageStr == "Registration") stage = TournamentStage::Registration;
-        else if (stageStr == "Qualifiers") stage = TournamentStage::Qualifiers;
-        else if (stageStr == "Tiebreakers") stage = TournamentStage::Tiebreakers;
-        else if (stageStr == "Quarterfinals") stage = TournamentStage::Quarterfinals;
-        else if (stageStr == "Semifinals") stage = TournamentStage::Semifinals;
-        else if (stageStr == "Finals") stage = TournamentStage::Finals;
-        else if (stageStr == "Completed") stage = TournamentStage::Completed;
-
-        Tournament t(
-            item["id"],
-            item["name"],
-            item["startDate"],
-            item["endDate"],
-            item["location"],
-            stage,
-            category,
-            item["maxParticipants"],
-            item["currentParticipants"],
-            item["prizePool"]
-        );
-        list.append(t);
-    }
-    return list;
+DoublyLinkedList<Tournament> JsonLoader::loadTournaments(const std::string& filename, std::uintmax_t* journalEnd) {
+    return loadList<Tournament>(filename, journalEnd);
+}
+
+DoublyLinkedList<Tournament> JsonLoader::loadAppendedTournaments(const std::string& filename, std::uintmax_t& journalOffset) {
+    return loadAppended<Tournament>(filename, journalOffset);
+}
+
+void JsonLoader::prefetchPlayers(const std::string& filename) {
+    prefetchList<Player>(filename);
+}
+
+void JsonLoader::prefetchCheckedInPlayers(const std::string& filename) {
+    WriteBehindCache::instance().flush(filename);
+    FileStamp stamp = stampOf(filename);
+    if (!stamp.exists) return;
+    std::uintmax_t journalEnd;
+    CheckInQueue queue = parseCheckedIn(filename, journalEnd);
+    storePrefetched(filename, stamp, std::move(queue), journalEnd);
+}
+
+void JsonLoader::prefetchMatches(const std::string& filename) {
+    prefetchList<Match>(filename);
+}
+
+void JsonLoader::prefetchResults(const std::string& filename) {
+    prefetchList<Result>(filename);
+}
+
+void JsonLoader::prefetchSpectators(const std::string& filename) {
+    prefetchList<Spectator>(filename);
+}
+
+void JsonLoader::prefetchTournaments(const std::string& filename) {
+    prefetchList<Tournament>(filename);
+}
+
+void JsonLoader::clearPrefetched() {
+    std::lock_guard<std::mutex> lock(prefetchMutex);
+    prefetchedOf<DoublyLinkedList<Player>>().clear();
+    prefetchedOf<CheckInQueue>().clear();
+    prefetchedOf<DoublyLinkedList<Match>>().clear();
+    prefetchedOf<DoublyLinkedList<Result>>().clear();
+    prefetchedOf<DoublyLinkedList<Spectator>>().clear();
+    prefetchedOf<DoublyLinkedList<Tournament>>().clear();
 }
@@ -1,11 +1,57 @@
 #include "helper/JsonWriter.hpp"
+#include "helper/DtoCodec.hpp"
 #include "helper/JsonLoader.hpp"
-#include <nlohmann/json.hpp>
+#include "helper/JsonJournal.hpp"
+#include "helper/SnapshotFile.hpp"
+#include "structures/DynamicArray.hpp"
+#include "structures/HashMap.hpp"
+#include "structures/HashSet.hpp"
+#include "helper/GroupCommit.hpp"
+#include "helper/WriteBehindCache.hpp"
 #include <fstream>
 #include <iostream>
 #include <filesystem>
+#include <mutex>
 
-using json = nlohmann::json;
+// Player ids of each players file as of the last save queued through
+// JsonWriter, so appendPlayer can reject duplicates without waiting for
+// queued saves or reading the file. A file is read once, the first time it
+// is appended to, unless a writeAllPlayers of it came first.
+struct PlayerIdIndex {
+    std::mutex mutex;
+    HashMap<std::string, HashSet<std::string>> ids;
+};
+
+static PlayerIdIndex& playerIdIndex() {
+    // Never destroyed, like GroupCommit: saves may run during static teardown
+    static PlayerIdIndex* index = new PlayerIdIndex();
+    return *index;
+}
+
+void JsonWriter::setStorageFormat(StorageFormat format) {
+    SnapshotFile::setFormat(format);
+}
+
+StorageFormat JsonWriter::getStorageFormat() {
+    return SnapshotFile::getFormat();
+}
+
+bool JsonWriter::convertFile(const std::string& filename, StorageFormat format) {
+    if (!WriteBehindCache::instance().flush(filename) || !JsonJournal::compact(filename)) {
+        return false;
+    }
+    return SnapshotFile::convert(filename, format);
+}
+
+bool JsonWriter::flush(const std::string& filename) {
+    return WriteBehindCache::instance().flush(filename);
+}
+
+void JsonWriter::reportFailedSaves() {
+    for (const std::string& filename : GroupCommit::instance().takeUnreportedFailures()) {
+        std::cout << "Warning: changes to " << filename << " could not be saved yet; retrying in the background." << std::endl;
+    }
+}
 
 // Player operations
 bool JsonWriter::appendPlayer(const Player& player, const std::string& filename) {
@@ -13,86 +59,69 @@ bool JsonWriter::appendPlayer(const Player& player, const std::string& filename)
         return false;
     }
     
-    // Load existing data
-    DoublyLinkedList<Player> existingPlayers = JsonLoader::loadPlayers(filename);
-    
-    // Check if player already exists (by ID)
-    for (int i = 0; i < existingPlayers.getSize(); i++) {
-        Player* existingPlayer = existingPlayers.get(i);
-        if (existingPlayer && existingPlayer->id == player.id) {
-            std::cout << "Player with ID " << player.id << " already exists. Skipping." << std::endl;
-            return false;
+    // Check if player already exists (by ID), including players still queued
+    PlayerIdIndex& index = playerIdIndex();
+    std::lock_guard<std::mutex> lock(index.mutex);
+    HashSet<std::string>* ids = index.ids.find(filename);
+    if (!ids) {
+        HashSet<std::string>& loaded = index.ids[filename];
+        for (const Player& existing : JsonLoader::readPlayers(filename)) {
+            loaded.insert(existing.id);
         }
+        ids = &loaded;
+    }
+    if (!ids->insert(player.id)) {
+        std::cout << "Player with ID " << player.id << " already exists. Skipping." << std::endl;
+        return false;
     }
     
-    // Add new player
-    existingPlayers.append(player);
-    
-    // Write back to file
-    return writeAllPlayers(existingPlayers, filename);
+    // Journal the new player instead of rewriting the whole file
+    WriteBehindCache::instance().submit(filename);
+    GroupCommit::instance().submitAppend(filename, DtoCodec::toJson(player));
+    return true;
 }
 
-bool JsonWriter::writeAllCheckedInPlayer(PriorityQueue<Player>& checkInQueue, const std::string& filename) {
-    json jsonArray = json::array();
-    
-    // Get all items from the queue with their priorities
-    int queueSize = checkInQueue.getSize();
-    if (queueSize == 0) {
-        // Create empty file if queue is empty
-        std::ofstream file(filename);
-        if (!file.is_open()) {
-            return false;
+bool JsonWriter::writeAllCheckedInPlayer(CheckInQueue& checkInQueue, const std::string& filename) {
+    // Encoded later on the write-behind thread, from a copy of the queue
+    WriteBehindCache::instance().markDirty(filename, [checkInQueue]() {
+        DynamicArray<CheckedInRecord> records;
+        
+        // Get all items from the queue with their priorities
+        int queueSize = checkInQueue.getSize();
+        if (queueSize > 0) {
+            Player* players = new Player[queueSize];
+            int* priorities = new int[queueSize];
+            int count = 0;
+            
+            checkInQueue.getAllItemsWithPriority(players, priorities, count);
+            for (int i = 0; i < count; i++) {
+                records.push_back(CheckedInRecord{players[i], priorities[i]});
+            }
+            
+            // Clean up dynamic arrays
+            delete[] players;
+            delete[] priorities;
         }
-        file << "[]";
-        file.close();
-        return true;
-    }
-    
-    Player* players = new Player[queueSize];
-    int* priorities = new int[queueSize];
-    int count = 0;
-    
-    checkInQueue.getAllItemsWithPriority(players, priorities, count);
-    
-    // Convert to JSON
-    for (int i = 0; i < count; i++) {
-        json playerJson = playerToJson(players[i]);
-        playerJson["priority"] = priorities[i];
-        jsonArray.push_back(playerJson);
-    }
-    
-    // Clean up dynamic arrays
-    delete[] players;
-    delete[] priorities;
-    
-    // Write to file (replace entire content)
-    std::ofstream file(filename);
-    if (!file.is_open()) {
-        return false;
-    }
-    
-    file << jsonArray.dump(4); // Pretty print with 4 spaces
-    file.close();
+        return DtoCodec::encodeArray(records);
+    });
     return true;
 }
 
 bool JsonWriter::writeAllPlayers(const DoublyLinkedList<Player>& players, const std::string& filename) {
-    json jsonArray = json::array();
-    
-    for (int i = 0; i < players.getSize(); i++) {
-        Player* player = players.get(i);
-        if (player) {
-            jsonArray.push_back(playerToJson(*player));
+    {
+        PlayerIdIndex& index = playerIdIndex();
+        std::lock_guard<std::mutex> lock(index.mutex);
+        HashSet<std::string>& ids = index.ids[filename];
+        ids.clear();
+        for (const Player& player : players) {
+            ids.insert(player.id);
         }
     }
-    
-    std::ofstream file(filename);
-    if (!file.is_open()) {
-        return false;
-    }
-    
-    file << jsonArray.dump(4); // Pretty print with 4 spaces
-    file.close();
+
+    // Encoded later on the write-behind thread, from a copy of the list
+    WriteBehindCache::instance().markDirty(filename, [players]() {
+        return DtoCodec::encodeArray(players);
+    });
     return true;
 }
 
@@ -102,31 +131,16 @@ bool JsonWriter::appendMatch(const Match& match, const std::string& filename) {
         return false;
     }
     
-    DoublyLinkedList<Match> existingMatches = JsonLoader::loadMatches(filename);
-    existingMatches.append(match);
-    return writeAllMatches(existingMatches, filename);
+    WriteBehindCache::instance().submit(filename);
+    GroupCommit::instance().submitAppend(filename, DtoCodec::toJson(match));
+    return true;
 }
 
 bool JsonWriter::writeAllMatches(const DoublyLinkedList<Match>& matches, const std::string& filename) {
-    json jsonArray = json::array();
-    
-    for (int i = 0; i < matches.getSize(); i++) {
-        Match* match = matches.get(i);
-        if (match) {
-            jsonArray.push_back(matchToJson(*match));
-        }
-    }
-    
-    std::ofstream file(filename);
-    if (!file.is_open()) {
-        std::cerr << "Failed to open file for writing: " << filename << std::endl;
-        return false;
-    }
-    
-    file << jsonArray.dump(4);
-    file.close();
-    
-    std::cout << "Successfully wrote " << matches.getSize() << " matches to " << filename << std::endl;
+    // Encoded later on the write-behind thread, from a copy of the list
+    WriteBehindCache::instance().markDirty(filename, [matches]() {
+        return DtoCodec::encodeArray(matches);
+    });
     return true;
 }
 
@@ -136,31 +150,16 @@ bool JsonWriter::appendPerformance(const Performance& performance, const std::st
         return false;
     }
     
-    DoublyLinkedList<Performance> existingPerformances = JsonLoader::loadPerformances(filename);
-    existingPerformances.append(performance);
-    return writeAllPerformances(existingPerformances, filename);
+    WriteBehindCache::instance().submit(filename);
+    GroupCommit::instance().submitAppend(filename, DtoCodec::toJson(performance));
+    return true;
 }
 
 bool JsonWriter::writeAllPerformances(const DoublyLinkedList<Performance>& performances, const std::string& filename) {
-    json jsonArray = json::array();
-    
-    for (int i = 0; i < performances.getSize(); i++) {
-        Performance* performance = performances.get(i);
-        if (performance) {
-            jsonArray.push_back(performanceToJson(*performance));
-        }
-    }
-    
-    std::ofstream file(filename);
-    if (!file.is_open()) {
-        std::cerr << "Failed to open file for writing: " << filename << std::endl;
-        return false;
-    }
-    
-    file << jsonArray.dump(4);
-    file.close();
-    
-    std::cout << "Successfully wrote " << performances.getSize() << " performances to " << filename << std::endl;
+    // Encoded later on the write-behind thread, from a copy of the list
+    WriteBehindCache::instance().markDirty(filename, [performances]() {
+        return DtoCodec::encodeArray(performances);
+    });
     return true;
 }
 
@@ -170,31 +169,16 @@ bool JsonWriter::appendResult(const Result& result, const std::string& filename)
         return false;
     }
     
-    DoublyLinkedList<Result> existingResults = JsonLoader::loadResults(filename);
-    existingResults.append(result);
-    return writeAllResults(existingResults, filename);
+    WriteBehindCache::instance().submit(filename);
+    GroupCommit::instance().submitAppend(filename, DtoCodec::toJson(result));
+    return true;
 }
 
 bool JsonWriter::writeAllResults(const DoublyLinkedList<Result>& results, const std::string& filename) {
-    json jsonArray = json::array();
-    
-    for (int i = 0; i < results.getSize(); i++) {
-        Result* result = results.get(i);
-        if (result) {
-            jsonArray.push_back(resultToJson(*result));
-        }
-    }
-    
-    std::ofstream file(filename);
-    if (!file.is_open()) {
-        std::cerr << "Failed to open file for writing: " << filename << std::endl;
-        return false;
-    }
-    
-    file << jsonArray.dump(4);
-    file.close();
-    
-    std::cout << "Successfully wrote " << results.getSize() << " results to " << filename << std::endl;
+    // Encoded later on the write-behind thread, from a copy of the list
+    WriteBehindCache::instance().markDirty(filename, [results]() {
+        return DtoCodec::encodeArray(results);
+    });
     return true;
 }
 
@@ -204,29 +188,16 @@ bool JsonWriter::appendSpectator(const Spectator& spectator, const std::string&
         return false;
     }
     
-    DoublyLinkedList<Spectator> existingSpectators = JsonLoader::loadSpectators(filename);
-    existingSpectators.append(spectator);
-    return writeAllSpectators(existingSpectators, filename);
+    WriteBehindCache::instance().submit(filename);
+    GroupCommit::instance().submitAppend(filename, DtoCodec::toJson(spectator));
+    return true;
 }
 
 bool JsonWriter::writeAllSpectators(const DoublyLinkedList<Spectator>& spectators, const std::string& filename) {
-    json jsonArray = json::array();
-    
-    for (int i = 0; i < spectators.getSize(); i++) {
-        Spectator* spectator = spectators.get(i);
-        if (spectator) {
-            jsonArray.push_back(spectatorToJson(*spectator));
-        }
-    }
-    
-    std::ofstream file(filename);
-    if (!file.is_open()) {
-        std::cerr << "Failed to open file for writing: " << filename << std::endl;
-        return false;
-    }
-    
-    file << jsonArray.dump(4);
-    file.close();
+    // Encoded later on the write-behind thread, from a copy of the list
+    WriteBehindCache::instance().markDirty(filename, [spectators]() {
+        return DtoCodec::encodeArray(spectators);
+    });
     
     // std::cout << "Successfully wrote " << spectators.getSize() << " spectators to " << filename << std::endl;
     return true;
@@ -238,9 +209,9 @@ bool JsonWriter::appendTournament(const Tournament& tournament, const std::strin
         return false;
     }
     
-    DoublyLinkedList<Tournament> existingTournaments = JsonLoader::loadTournaments(filename);
-    existingTournaments.append(tournament);
-    return writeAllTournaments(existingTournaments, filename);
+    WriteBehindCache::instance().submit(filename);
+    GroupCommit::instance().submitAppend(filename, DtoCodec::toJson(tournament));
+    return true;
 }
 
 bool JsonWriter::writeAllTournaments(const DoublyLinkedList<Tournament>& tournaments, const std::string& filename) {
@@ -248,25 +219,10 @@ bool JsonWriter::writeAllTournaments(const DoublyLinkedList<Tournament>& tournam
         return false;
     }
     
-    json jsonArray = json::array();
-    
-    for (int i = 0; i < tournaments.getSize(); i++) {
-        Tournament* tournament = tournaments.get(i);
-        if (tournament) {
-            jsonArray.push_back(tournamentToJson(*tournament));
-        }
-    }
-    
-    std::ofstream file(filename);
-    if (!file.is_open()) {
-        std::cerr << "Failed to open file for writing: " << filename << std::endl;
-        return false;
-    }
-    
-    file << jsonArray.dump(4);
-    file.close();
-    
-    std::cout << "Successfully wrote " << tournaments.getSize() << " tournaments to " << filename << std::endl;
+    // Encoded later on the write-behind thread, from a copy of the list
+    WriteBehindCache::instance().markDirty(filename, [tournaments]() {
+        return DtoCodec::encodeArray(tournaments);
+    });
     return true;
 }
 
@@ -310,142 +266,3 @@ bool JsonWriter::createDirectoryIfNotExists(const std::string& path) {
     }
     return true;
 }
-
-// Conversion functions
-json JsonWriter::playerToJson(const Player& player) {
-    return json{
-        {"id", player.id},
-        {"name", player.name},
-        {"age", player.age},
-        {"gender", genderToString(player.gender)},
-        {"email", player.email},
-        {"phoneNum", player.phoneNum},
-        {"points", player.points},
-        {"isEarlyBird", player.isEarlyBird},
-        {"isWildcard", player.isWildcard},
-        {"isLate", player.isLate},
-        {"dateJoined", player.dateJoined}
-    };
-}
-
-json JsonWriter::matchToJson(const Match& match) {
-    return json{
-        {"id", match.id},
-        {"tournamentId", match.tournamentId},
-        {"stage", tournamentStageToString(match.stage)},
-        {"date", match.date},
-        {"time", match.time},
-        {"player1", match.player1},
-        {"player2", match.player2}
-    };
-}
-
-json JsonWriter::performanceToJson(const Performance& performance) {
-    return json{
-        {"playerId", performance.playerId},
-        {"matchesPlayed", performance.matchesPlayed},
-        {"favouriteChampion", performance.favouriteChampion},
-        {"lastWin", performance.lastWin},
-        {"winRate", performance.winRate}
-    };
-}
-
-json JsonWriter::resultToJson(const Result& result) {
-    return json{
-        {"id", result.id},
-        {"matchId", result.matchId},
-        {"championsP1", championToString(result.championsP1)},
-        {"championsP2", championToString(result.championsP2)},
-        {"winnerId", result.winnerId}
-    };
-}
-
-json JsonWriter::spectatorToJson(const Spectator& spectator) {
-    std::string formattedId = "S" + std::string(5 - std::to_string(spectator.id).length(), '0') + std::to_string(spectator.id);
-
-    return json{
-        {"id", formattedId},
-        {"name", spectator.name},
-        {"gender", genderToString(spectator.gender)},
-        {"email", spectator.email},
-        {"phoneNum", spectator.phoneNum},
-        {"type", spectatorTypeToString(spectator.type)},
-        {"affiliation", spectator.affiliation}
-    };
-}
-
-json JsonWriter::tournamentToJson(const Tournament& tournament) {
-    return json{
-        {"id", tournament.id},
-        {"name", tournament.name},
-        {"startDate", tournament.startDate},
-        {"endDate", tournament.endDate},
-        {"location", tournament.location},
-        {"stage", tournamentStageToString(tournament.stage)},
-        {"category", tournamentCategoryToString(tournament.category)},
-        {"maxParticipants", tournament.maxParticipants},
-        {"currentParticipants", tournament.currentParticipants},
-        {"prizePool", tournament.prizePool}
-    };
-}
-
-// String conversion helpers
-std::string JsonWriter::championToString(Champion champion) {
-    switch (champion) {
-        case Champion::Akali: return "Akali";
-        case Champion::Ezreal: return "Ezreal";
-        case Champion::Fiora: return "Fiora";
-        case Champion::Fizz: return "Fizz";
-        case Champion::Garen: return "Garen";
-        case Champion::Jax: return "Jax";
-        case Champion::Katarina: return "Katarina";
-        case Champion::LeeSin: return "LeeSin";
-        case Champion::Riven: return "Riven";
-        case Champion::Yasuo: return "Yasuo";
-        case Champion::Zed: return "Zed";
-        case Champion::NoChampion: return "NoChampion";
-        default: return "NoChampion";
-    }
-}
-
-std::string JsonWriter::genderToString(Gender gender) {
-    switch (gender) {
-        case Gender::Male: return "Male";
-        case Gender::Female: return "Female";
-        default: return "Male";
-    }
-}
-
-std::string JsonWriter::spectatorTypeToString(SpectatorType type) {
-    switch (type) {
-        case SpectatorType::Normal: return "Normal";
-        case SpectatorType::VIP: return "VIP";
-        case SpectatorType::Streamer: return "Streamer";
-        case SpectatorType::Influencer: return "Influencer";
-        case SpectatorType::Player: return "Player";
-        default: return "Normal";
-    }
-}
-
-std::string JsonWriter::tournamentStageToString(TournamentStage stage) {
-    switch (stage) {
-        case TournamentStage::Registration: return "Registration";
-        case TournamentStage::Qualifiers: return "Qualifiers";
-        case TournamentStage::Tiebreakers: return "Tiebreakers";
-        case TournamentStage::Quarterfinals: return "Quarterfinals";
-        case TournamentStage::Semifinals: return "Semifinals";
-        case TournamentStage::Finals: return "Finals";
-        case TournamentStage::Completed: return "Completed";
-        default: return "Registration";
-    }
-}
-
-std::string JsonWriter::tournamentCategoryToString(TournamentCategory category) {
-    switch (category) {
-        case TournamentCategory::Local: return "Local";
-        case TournamentCategory::Regional: return "Regional";
-        case TournamentCategory::National: return "National";
-        case TournamentCategory::International: return "International";
-        default: return "Regional";
-    }
-}
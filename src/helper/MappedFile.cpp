@@ -0,0 +1,144 @@
+#include "helper/MappedFile.hpp"
+#include <fstream>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile()
+    : bytes(""), length(0), opened(false), mapping(nullptr)
+#ifdef _WIN32
+    , mappingHandle(nullptr)
+#endif
+{}
+
+MappedFile::MappedFile(const std::string& filename) : MappedFile() {
+    open(filename);
+}
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept : MappedFile() {
+    swap(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        close();
+        swap(other);
+    }
+    return *this;
+}
+
+void MappedFile::swap(MappedFile& other) noexcept {
+    std::swap(length, other.length);
+    std::swap(opened, other.opened);
+    std::swap(mapping, other.mapping);
+#ifdef _WIN32
+    std::swap(mappingHandle, other.mappingHandle);
+#endif
+    std::swap(bytes, other.bytes);
+    fallback.swap(other.fallback);
+    // An unmapped file points into its fallback buffer, which may live inline
+    // (small-string storage) and so does not follow the swap
+    if (!mapping) bytes = opened ? fallback.data() : "";
+    if (!other.mapping) other.bytes = other.opened ? other.fallback.data() : "";
+}
+
+// Map the whole file; false (with nothing mapped) if the OS refuses
+static bool mapWhole(const std::string& filename, void*& base, std::size_t& size, void*& handle) {
+#ifdef _WIN32
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE view = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!view) return false;
+    base = MapViewOfFile(view, FILE_MAP_READ, 0, 0, 0);
+    if (!base) {
+        CloseHandle(view);
+        return false;
+    }
+    size = static_cast<std::size_t>(fileSize.QuadPart);
+    handle = view;
+    return true;
+#else
+    (void)handle;
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat info;
+    if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode) || info.st_size == 0) {
+        ::close(fd);
+        return false;
+    }
+    void* region = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (region == MAP_FAILED) return false;
+    // Loaders scan front to back once
+    madvise(region, static_cast<std::size_t>(info.st_size), MADV_SEQUENTIAL);
+    base = region;
+    size = static_cast<std::size_t>(info.st_size);
+    return true;
+#endif
+}
+
+bool MappedFile::open(const std::string& filename) {
+    close();
+
+    void* base = nullptr;
+    void* handle = nullptr;
+    std::size_t size = 0;
+    if (mapWhole(filename, base, size, handle)) {
+        mapping = base;
+#ifdef _WIN32
+        mappingHandle = handle;
+#endif
+        bytes = static_cast<const char*>(base);
+        length = size;
+        opened = true;
+        return true;
+    }
+
+    // Empty files, pipes and filesystems without mmap support
+    std::ifstream in(filename, std::ios::binary);
+    if (!in.is_open()) return false;
+    fallback.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    bytes = fallback.data();
+    length = fallback.size();
+    opened = true;
+    return true;
+}
+
+void MappedFile::close() {
+    if (mapping) {
+#ifdef _WIN32
+        UnmapViewOfFile(mapping);
+        CloseHandle(static_cast<HANDLE>(mappingHandle));
+        mappingHandle = nullptr;
+#else
+        munmap(mapping, length);
+#endif
+        mapping = nullptr;
+    }
+    fallback.clear();
+    fallback.shrink_to_fit();
+    bytes = "";
+    length = 0;
+    opened = false;
+}
@@ -0,0 +1,44 @@
+#include "helper/ResultEvents.hpp"
+#include "structures/DynamicArray.hpp"
+#include <utility>
+
+struct Subscription {
+    int id;
+    ResultEvents::Listener listener;
+};
+
+struct Subscriptions {
+    DynamicArray<Subscription> entries;
+    int nextId = 1;
+};
+
+static Subscriptions& subscriptions() {
+    // Never destroyed: global subscribers unsubscribe while statics are torn down
+    static Subscriptions* all = new Subscriptions();
+    return *all;
+}
+
+int ResultEvents::subscribe(Listener listener) {
+    Subscriptions& all = subscriptions();
+    int id = all.nextId++;
+    all.entries.push_back(Subscription{id, std::move(listener)});
+    return id;
+}
+
+void ResultEvents::unsubscribe(int id) {
+    DynamicArray<Subscription>& entries = subscriptions().entries;
+    for (int i = 0; i < entries.getSize(); ++i) {
+        if (entries[i].id == id) {
+            entries.erase(i);
+            return;
+        }
+    }
+}
+
+void ResultEvents::publish(const std::string& filename, const Result& result) {
+    // Copy, so a listener may subscribe or unsubscribe while being called
+    DynamicArray<Subscription> entries = subscriptions().entries;
+    for (const Subscription& entry : entries) {
+        entry.listener(filename, result);
+    }
+}
@@ -0,0 +1,201 @@
+#include "helper/ResultJoin.hpp"
+#include "helper/JsonLoader.hpp"
+#include <iostream>
+#include <utility>
+
+const DynamicArray<int> ResultJoin::NO_RESULTS;
+
+ResultJoin::ResultJoin(ResultStore& results, const std::string& matchesFile, const std::string& playersFile)
+    : results(results), matchesWatch(matchesFile), playersWatch(playersFile),
+      joinedCount(0), joinedGeneration(-1), generation(0) {}
+
+void ResultJoin::sync() {
+    bool rejoin = syncMatches(results.current());
+    syncPlayers();
+
+    // Matches changed under joined results
+    if (rejoin) {
+        resetIndexes();
+        joinedGeneration = results.getGeneration();
+    }
+    extend();
+}
+
+void ResultJoin::extend() {
+    const ChunkedLog<Result>& log = results.resident();
+
+    // Results were reloaded
+    if (joinedGeneration != results.getGeneration() || joinedCount > log.getSize()) {
+        resetIndexes();
+        joinedGeneration = results.getGeneration();
+    }
+
+    for (; joinedCount < log.getSize(); ++joinedCount) {
+        const Result& result = log[joinedCount];
+        const Match* match = findMatch(result.matchId);
+        if (!match) {
+            unmatched.push_back(joinedCount);
+            continue;
+        }
+        byPlayer[match->player1].push_back(joinedCount);
+        if (match->player2 != match->player1) byPlayer[match->player2].push_back(joinedCount);
+        byTournament[match->tournamentId].push_back(joinedCount);
+    }
+}
+
+ResultJoin::Rows ResultJoin::rows() {
+    sync();
+    return Rows(this, results.current().getSize());
+}
+
+ResultJoin::Rows ResultJoin::joinedRows() const {
+    return Rows(this, joinedCount);
+}
+
+JoinedRow ResultJoin::row(int index) const {
+    return join(results.resident()[index]);
+}
+
+JoinedRow ResultJoin::join(const Result& result) const {
+    JoinedRow joined;
+    joined.result = &result;
+    joined.match = findMatch(result.matchId);
+    if (joined.match) {
+        joined.player1 = findPlayer(joined.match->player1);
+        joined.player2 = findPlayer(joined.match->player2);
+    }
+    return joined;
+}
+
+const FileWatch& ResultJoin::getMatchesWatch() const {
+    return matchesWatch;
+}
+
+const FileWatch& ResultJoin::getPlayersWatch() const {
+    return playersWatch;
+}
+
+const Match* ResultJoin::findMatch(const std::string& matchId) const {
+    const int* index = matchIndexById.find(matchId);
+    return index ? &matches[*index] : nullptr;
+}
+
+const Player* ResultJoin::findPlayer(const std::string& playerId) const {
+    const int* index = playerIndexById.find(playerId);
+    return index ? &players[*index] : nullptr;
+}
+
+const DynamicArray<int>& ResultJoin::resultsOfPlayer(const std::string& playerId) {
+    sync();
+    const DynamicArray<int>* positions = byPlayer.find(playerId);
+    return positions ? *positions : NO_RESULTS;
+}
+
+const DynamicArray<int>& ResultJoin::resultsOfTournament(const std::string& tournamentId) {
+    sync();
+    const DynamicArray<int>* positions = byTournament.find(tournamentId);
+    return positions ? *positions : NO_RESULTS;
+}
+
+int ResultJoin::getUnmatchedCount() const {
+    return unmatched.getSize();
+}
+
+int ResultJoin::getUnmatchedCount(int count) const {
+    // Positions are recorded in ascending order
+    int low = 0, high = unmatched.getSize();
+    while (low < high) {
+        int middle = (low + high) / 2;
+        if (unmatched[middle] < count) low = middle + 1;
+        else high = middle;
+    }
+    return low;
+}
+
+long long ResultJoin::getGeneration() const {
+    return generation;
+}
+
+// True if results already joined may now resolve differently: the file was
+// replaced, an appended match reuses an id, or it matches an unmatched result
+bool ResultJoin::syncMatches(const ChunkedLog<Result>& log) {
+    FileWatch::Change change = matchesWatch.check();
+    if (change == FileWatch::Change::None) return false;
+
+    bool rejoin = change == FileWatch::Change::Replaced;
+    std::uintmax_t journalOffset = matchesWatch.getJournalOffset();
+    try {
+        DoublyLinkedList<Match> loaded;
+        if (change == FileWatch::Change::Appended) {
+            loaded = JsonLoader::loadAppendedMatches(matchesWatch.getFilename(), journalOffset);
+        } else {
+            matches.clear();
+            matchIndexById.clear();
+            loaded = JsonLoader::loadMatches(matchesWatch.getFilename(), &journalOffset);
+        }
+        matches.reserve(matches.getSize() + loaded.getSize());
+        for (Match& match : loaded) {
+            if (!addMatch(std::move(match))) rejoin = true;
+        }
+        matchesWatch.loaded(journalOffset);
+    } catch (const std::exception& e) {
+        std::cerr << "Error loading matches: " << e.what() << std::endl;
+        matches.clear();
+        matchIndexById.clear();
+        matchesWatch.invalidate();
+        return true;
+    }
+
+    for (int i = 0; !rejoin && i < unmatched.getSize(); ++i) {
+        int position = unmatched[i];
+        if (position < log.getSize() && findMatch(log[position].matchId)) rejoin = true;
+    }
+    return rejoin;
+}
+
+void ResultJoin::syncPlayers() {
+    FileWatch::Change change = playersWatch.check();
+    if (change == FileWatch::Change::None) return;
+
+    std::uintmax_t journalOffset = playersWatch.getJournalOffset();
+    try {
+        DoublyLinkedList<Player> loaded;
+        if (change == FileWatch::Change::Appended) {
+            loaded = JsonLoader::readAppendedPlayers(playersWatch.getFilename(), journalOffset);
+        } else {
+            players.clear();
+            playerIndexById.clear();
+            loaded = JsonLoader::readPlayers(playersWatch.getFilename(), &journalOffset);
+        }
+        players.reserve(players.getSize() + loaded.getSize());
+        for (Player& player : loaded) {
+            addPlayer(std::move(player));
+        }
+        playersWatch.loaded(journalOffset);
+    } catch (const std::exception& e) {
+        std::cerr << "Error loading players: " << e.what() << std::endl;
+        players.clear();
+        playerIndexById.clear();
+        playersWatch.invalidate();
+    }
+}
+
+// False if the id was already taken (the new match replaces it in lookups)
+bool ResultJoin::addMatch(Match&& match) {
+    bool added = matchIndexById.insert(match.id, matches.getSize());
+    matches.push_back(std::move(match));
+    return added;
+}
+
+void ResultJoin::addPlayer(Player&& player) {
+    playerIndexById.insert(player.id, players.getSize());
+    players.push_back(std::move(player));
+}
+
+void ResultJoin::resetIndexes() {
+    byPlayer.clear();
+    byTournament.clear();
+    unmatched.clear();
+    joinedCount = 0;
+    generation++;
+}
@@ -0,0 +1,125 @@
+#include "helper/ResultStore.hpp"
+#include "helper/JsonLoader.hpp"
+#include "helper/ResultEvents.hpp"
+#include <iostream>
+#include <utility>
+
+ResultStore::ResultStore(const std::string& filename) : watch(filename), generation(0), subscription(0) {
+    subscription = ResultEvents::subscribe([this](const std::string& savedTo, const Result& result) {
+        if (savedTo != watch.getFilename()) return;
+        counters.notified++;
+        add(Result(result));
+    });
+}
+
+ResultStore::~ResultStore() {
+    ResultEvents::unsubscribe(subscription);
+}
+
+const std::string& ResultStore::getFilename() const {
+    return watch.getFilename();
+}
+
+const FileWatch& ResultStore::getWatch() const {
+    return watch;
+}
+
+const ChunkedLog<Result>& ResultStore::current() {
+    sync();
+    return results;
+}
+
+const ChunkedLog<Result>& ResultStore::resident() const {
+    return results;
+}
+
+const Result* ResultStore::findById(const std::string& id) {
+    sync();
+    const int* index = indexById.find(id);
+    return index ? &results[*index] : nullptr;
+}
+
+const Result* ResultStore::findByMatchId(const std::string& matchId) {
+    int index = indexOfMatchId(matchId);
+    return index != -1 ? &results[index] : nullptr;
+}
+
+int ResultStore::indexOfMatchId(const std::string& matchId) {
+    sync();
+    const int* index = indexByMatchId.find(matchId);
+    return index ? *index : -1;
+}
+
+DynamicArray<const Result*> ResultStore::findByWinner(const std::string& winnerId) {
+    sync();
+    DynamicArray<const Result*> found;
+    const DynamicArray<int>* indices = indexByWinner.find(winnerId);
+    if (indices) {
+        found.reserve(indices->getSize());
+        for (int index : *indices) {
+            found.push_back(&results[index]);
+        }
+    }
+    return found;
+}
+
+void ResultStore::refresh() {
+    watch.invalidate();
+    sync();
+}
+
+ResultStore::Counters ResultStore::getCounters() const {
+    return counters;
+}
+
+long long ResultStore::getGeneration() const {
+    return generation;
+}
+
+void ResultStore::sync() {
+    FileWatch::Change change = watch.check();
+    if (change == FileWatch::Change::None) {
+        counters.hits++;
+        return;
+    }
+
+    std::uintmax_t journalOffset = watch.getJournalOffset();
+    try {
+        if (change == FileWatch::Change::Appended) {
+            counters.tailReads++;
+            DoublyLinkedList<Result> appended = JsonLoader::loadAppendedResults(watch.getFilename(), journalOffset);
+            for (Result& result : appended) {
+                // Our own saves are already here, delivered by ResultEvents
+                if (!indexById.contains(result.id)) add(std::move(result));
+            }
+        } else {
+            counters.reloads++;
+            clear();
+            DoublyLinkedList<Result> loaded = JsonLoader::loadResults(watch.getFilename(), &journalOffset);
+            for (Result& result : loaded) {
+                add(std::move(result));
+            }
+        }
+        watch.loaded(journalOffset);
+    } catch (const std::exception& e) {
+        std::cerr << "Error loading results: " << e.what() << std::endl;
+        clear();
+        watch.invalidate();
+    }
+}
+
+void ResultStore::add(Result&& result) {
+    int index = results.getSize();
+    indexById.insert(result.id, index);
+    if (!indexByMatchId.contains(result.matchId)) indexByMatchId.insert(result.matchId, index);
+    indexByWinner[result.winnerId].push_back(index);
+    results.append(std::move(result));
+}
+
+void ResultStore::clear() {
+    generation++;
+    results.clear();
+    indexById.clear();
+    indexByMatchId.clear();
+    indexByWinner.clear();
+}
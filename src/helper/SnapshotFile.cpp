@@ -0,0 +1,131 @@
+#include "helper/SnapshotFile.hpp"
+#include "helper/MappedFile.hpp"
+#include "helper/AtomicFile.hpp"
+#include <atomic>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+using json = nlohmann::json;
+
+static const char MAGIC[4] = {'E', 'C', 'M', 'B'};
+
+// Format byte values are part of the file layout; do not renumber
+static const unsigned char FORMAT_MESSAGEPACK = 1;
+static const unsigned char FORMAT_CBOR = 2;
+
+static std::atomic<StorageFormat>& currentFormat() {
+    static std::atomic<StorageFormat> format(StorageFormat::Json);
+    return format;
+}
+
+void SnapshotFile::setFormat(StorageFormat format) {
+    currentFormat().store(format);
+}
+
+StorageFormat SnapshotFile::getFormat() {
+    return currentFormat().load();
+}
+
+bool SnapshotFile::parseFormatName(const std::string& name, StorageFormat& format) {
+    if (name == "json") format = StorageFormat::Json;
+    else if (name == "msgpack") format = StorageFormat::MessagePack;
+    else if (name == "cbor") format = StorageFormat::Cbor;
+    else return false;
+    return true;
+}
+
+const char* SnapshotFile::formatName(StorageFormat format) {
+    switch (format) {
+        case StorageFormat::MessagePack: return "msgpack";
+        case StorageFormat::Cbor: return "cbor";
+        default: return "json";
+    }
+}
+
+json::input_format_t SnapshotFile::inputFormat(StorageFormat format) {
+    switch (format) {
+        case StorageFormat::MessagePack: return json::input_format_t::msgpack;
+        case StorageFormat::Cbor: return json::input_format_t::cbor;
+        default: return json::input_format_t::json;
+    }
+}
+
+// header holds HEADER_SIZE bytes starting with the magic
+static StorageFormat formatFromHeader(const char* header) {
+    if (static_cast<unsigned char>(header[4]) != SnapshotFile::VERSION) {
+        throw std::runtime_error("Unsupported snapshot version " + std::to_string(static_cast<unsigned char>(header[4])));
+    }
+    switch (static_cast<unsigned char>(header[5])) {
+        case FORMAT_MESSAGEPACK: return StorageFormat::MessagePack;
+        case FORMAT_CBOR: return StorageFormat::Cbor;
+        default: throw std::runtime_error("Unknown snapshot format byte");
+    }
+}
+
+StorageFormat SnapshotFile::readHeader(std::istream& in) {
+    if (in.peek() != MAGIC[0]) return StorageFormat::Json;
+
+    char header[HEADER_SIZE];
+    if (!in.read(header, HEADER_SIZE) || std::memcmp(header, MAGIC, sizeof(MAGIC)) != 0) {
+        throw std::runtime_error("Unrecognised snapshot header");
+    }
+    return formatFromHeader(header);
+}
+
+StorageFormat SnapshotFile::readHeader(std::string_view& bytes) {
+    if (bytes.empty() || bytes[0] != MAGIC[0]) return StorageFormat::Json;
+
+    if (bytes.size() < static_cast<std::size_t>(HEADER_SIZE) || std::memcmp(bytes.data(), MAGIC, sizeof(MAGIC)) != 0) {
+        throw std::runtime_error("Unrecognised snapshot header");
+    }
+    StorageFormat format = formatFromHeader(bytes.data());
+    bytes.remove_prefix(HEADER_SIZE);
+    return format;
+}
+
+bool SnapshotFile::read(const std::string& filename, json& data) {
+    MappedFile file(filename);
+    if (!file.isOpen()) return false;
+    try {
+        std::string_view bytes = file.view();
+        StorageFormat format = readHeader(bytes);
+        const char* first = bytes.data();
+        const char* last = bytes.data() + bytes.size();
+        switch (format) {
+            case StorageFormat::MessagePack: data = json::from_msgpack(first, last); break;
+            case StorageFormat::Cbor: data = json::from_cbor(first, last); break;
+            default: data = json::parse(first, last); break;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Failed to parse " << filename << ": " << e.what() << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool SnapshotFile::write(const std::string& filename, const json& data) {
+    return write(filename, data, getFormat());
+}
+
+std::string SnapshotFile::encode(const json& data, StorageFormat format) {
+    if (format == StorageFormat::Json) {
+        return data.dump(4);
+    }
+    std::string bytes(MAGIC, sizeof(MAGIC));
+    bytes += static_cast<char>(VERSION);
+    bytes += static_cast<char>(format == StorageFormat::Cbor ? FORMAT_CBOR : FORMAT_MESSAGEPACK);
+    if (format == StorageFormat::Cbor) json::to_cbor(data, bytes);
+    else json::to_msgpack(data, bytes);
+    return bytes;
+}
+
+bool SnapshotFile::write(const std::string& filename, const json& data, StorageFormat format) {
+    return AtomicFile::write(filename, encode(data, format));
+}
+
+bool SnapshotFile::convert(const std::string& filename, StorageFormat format) {
+    json data;
+    if (!read(filename, data)) return false;
+    return write(filename, data, format);
+}
@@ -0,0 +1,96 @@
+#include "helper/StartupLoader.hpp"
+#include "helper/JsonLoader.hpp"
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+using Clock = std::chrono::steady_clock;
+
+static double millisecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+StartupLoader::StartupLoader() {
+    DynamicArray<Task> tasks = defaultTasks();
+    unsigned threadCount = threadsFor(tasks.getSize());
+    double total = run(tasks, threadCount);
+    printReport(tasks, total, threadCount);
+}
+
+DynamicArray<StartupLoader::Task> StartupLoader::defaultTasks() {
+    DynamicArray<Task> tasks;
+    auto add = [&tasks](const char* filename, PrefetchFn prefetch) {
+        Task task;
+        task.filename = filename;
+        task.prefetch = prefetch;
+        tasks.push_back(std::move(task));
+    };
+    // Largest files first so the longest parses start earliest
+    add("data/results.json", &JsonLoader::prefetchResults);
+    add("data/players.json", &JsonLoader::prefetchPlayers);
+    add("../data/spectators.json", &JsonLoader::prefetchSpectators);
+    add("data/matches.json", &JsonLoader::prefetchMatches);
+    add("data/tournaments.json", &JsonLoader::prefetchTournaments);
+    add("data/temp_registered_players.json", &JsonLoader::prefetchPlayers);
+    add("data/temp_checkin_queue.json", &JsonLoader::prefetchCheckedInPlayers);
+    return tasks;
+}
+
+unsigned StartupLoader::threadsFor(int taskCount, unsigned requested) {
+    unsigned threads = requested ? requested : std::thread::hardware_concurrency();
+    if (threads == 0) threads = 2;
+    if (taskCount < 1) taskCount = 1;
+    if (threads > static_cast<unsigned>(taskCount)) threads = static_cast<unsigned>(taskCount);
+    return threads;
+}
+
+double StartupLoader::run(DynamicArray<Task>& tasks, unsigned threadCount) {
+    Clock::time_point start = Clock::now();
+    threadCount = threadsFor(tasks.getSize(), threadCount);
+
+    // Workers pull the next unclaimed task until none are left
+    std::atomic<int> next(0);
+    auto work = [&tasks, &next]() {
+        for (int i = next++; i < tasks.getSize(); i = next++) {
+            Task& task = tasks[i];
+            Clock::time_point taskStart = Clock::now();
+            std::error_code ec;
+            task.missing = !std::filesystem::exists(task.filename, ec);
+            try {
+                task.prefetch(task.filename);
+            } catch (const std::exception&) {
+                // The owning manager loads (and reports) the file itself
+                task.failed = true;
+            }
+            task.milliseconds = millisecondsSince(taskStart);
+        }
+    };
+
+    DynamicArray<std::thread> workers;
+    for (unsigned i = 1; i < threadCount; i++) {
+        workers.push_back(std::thread(work));
+    }
+    work();
+    for (int i = 0; i < workers.getSize(); i++) {
+        workers[i].join();
+    }
+    return millisecondsSince(start);
+}
+
+void StartupLoader::printReport(const DynamicArray<Task>& tasks, double totalMilliseconds, unsigned threadCount) {
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "Loaded " << tasks.getSize() << " data files in " << totalMilliseconds
+              << " ms on " << threadCount << " thread(s):\n";
+    for (int i = 0; i < tasks.getSize(); i++) {
+        const Task& task = tasks[i];
+        std::cout << "  " << std::setw(8) << task.milliseconds << " ms  " << task.filename;
+        if (task.missing) std::cout << " (missing)";
+        else if (task.failed) std::cout << " (failed)";
+        std::cout << "\n";
+    }
+    std::cout << std::defaultfloat << std::setprecision(6);
+}
@@ -0,0 +1,225 @@
+#include "helper/WriteBehindCache.hpp"
+#include "helper/GroupCommit.hpp"
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <utility>
+
+// 64-bit FNV-1a; only used to notice identical consecutive snapshots
+static std::uint64_t contentHash(const std::string& text) {
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (unsigned char c : text) {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+WriteBehindCache& WriteBehindCache::instance() {
+    // Never destroyed, like GroupCommit. Creating GroupCommit first registers
+    // its exit hook first, so ours runs before it and nothing is left behind.
+    static WriteBehindCache* cache = [] {
+        GroupCommit::instance();
+        WriteBehindCache* created = new WriteBehindCache();
+        std::atexit([] { WriteBehindCache::instance().shutdown(); });
+        return created;
+    }();
+    return *cache;
+}
+
+WriteBehindCache::WriteBehindCache()
+    : maxStaleness(250), stopping(false), running(false) {}
+
+void WriteBehindCache::setMaxStaleness(std::chrono::milliseconds staleness) {
+    std::lock_guard<std::mutex> lock(stateMutex);
+    maxStaleness = staleness.count() < 0 ? std::chrono::milliseconds(0) : staleness;
+}
+
+std::chrono::milliseconds WriteBehindCache::getMaxStaleness() const {
+    std::lock_guard<std::mutex> lock(stateMutex);
+    return maxStaleness;
+}
+
+void WriteBehindCache::markDirty(const std::string& filename, Snapshot snapshot) {
+    bool immediate;
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        counters.marked++;
+        Snapshot* found = dirty.find(filename);
+        if (found) {
+            *found = std::move(snapshot);
+            counters.coalesced++;
+        } else {
+            dirty[filename] = std::move(snapshot);
+        }
+        immediate = stopping;
+        if (!immediate && !running) {
+            running = true;
+            worker = std::thread(&WriteBehindCache::run, this);
+        }
+    }
+    if (immediate) flush(filename);
+    else wakeUp.notify_one();
+}
+
+bool WriteBehindCache::isDirty(const std::string& filename) const {
+    std::lock_guard<std::mutex> lock(stateMutex);
+    return dirty.contains(filename);
+}
+
+void WriteBehindCache::submit(const std::string& filename) {
+    std::lock_guard<std::mutex> handOffLock(handOffMutex);
+    submitPending(filename);
+
+    // The caller is about to change the file behind the cache's back
+    std::lock_guard<std::mutex> lock(stateMutex);
+    lastHash.erase(filename);
+    generation[filename]++;
+}
+
+void WriteBehindCache::discard(const std::string& filename) {
+    std::lock_guard<std::mutex> handOffLock(handOffMutex);
+    std::lock_guard<std::mutex> lock(stateMutex);
+    if (dirty.erase(filename)) counters.coalesced++;
+    lastHash.erase(filename);
+    generation[filename]++;
+}
+
+bool WriteBehindCache::flush() {
+    submitAll();
+    bool ok = GroupCommit::instance().flush();
+
+    std::lock_guard<std::mutex> lock(stateMutex);
+    if (!failed.isEmpty()) {
+        failed.clear();
+        ok = false;
+    }
+    return ok;
+}
+
+bool WriteBehindCache::flush(const std::string& filename) {
+    {
+        std::lock_guard<std::mutex> handOffLock(handOffMutex);
+        submitPending(filename);
+    }
+    bool ok = GroupCommit::instance().flush(filename);
+
+    std::lock_guard<std::mutex> lock(stateMutex);
+    if (failed.erase(filename)) ok = false;
+    return ok;
+}
+
+void WriteBehindCache::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        stopping = true;
+    }
+    wakeUp.notify_all();
+    if (worker.joinable()) worker.join();
+    flush();
+}
+
+WriteBehindCache::Counters WriteBehindCache::getCounters() const {
+    std::lock_guard<std::mutex> lock(stateMutex);
+    return counters;
+}
+
+void WriteBehindCache::run() {
+    std::unique_lock<std::mutex> lock(stateMutex);
+    while (true) {
+        wakeUp.wait(lock, [this] { return stopping || !dirty.isEmpty(); });
+        if (stopping) break;    // shutdown() flushes whatever is left
+
+        // The first change waits at most maxStaleness; later ones ride along
+        wakeUp.wait_for(lock, maxStaleness, [this] { return stopping; });
+        if (stopping) break;
+
+        lock.unlock();
+        submitAll();
+        lock.lock();
+    }
+}
+
+void WriteBehindCache::submitAll() {
+    std::lock_guard<std::mutex> handOffLock(handOffMutex);
+    HashMap<std::string, Snapshot> batch;
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        batch.swap(dirty);
+    }
+    batch.forEach([this](const std::string& filename, Snapshot& snapshot) {
+        handOff(filename, std::move(snapshot));
+    });
+}
+
+// Called with handOffMutex held
+void WriteBehindCache::submitPending(const std::string& filename) {
+    Snapshot snapshot;
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        Snapshot* found = dirty.find(filename);
+        if (!found) return;
+        snapshot = std::move(*found);
+        dirty.erase(filename);
+    }
+    handOff(filename, std::move(snapshot));
+}
+
+// Called with handOffMutex held. GroupCommit builds the snapshot when it
+// commits the file; the build and the completion both run on the committing
+// thread, one after the other, and share the content hash.
+void WriteBehindCache::handOff(const std::string& filename, Snapshot snapshot) {
+    long long handedIn;
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        handedIn = generation[filename];
+    }
+    auto hash = std::make_shared<std::uint64_t>(0);
+    GroupCommit::instance().submitSnapshot(
+        filename,
+        [this, filename, snapshot = std::move(snapshot), hash](std::string& data) {
+            return build(filename, snapshot, data, *hash);
+        },
+        [this, filename, hash, handedIn](bool ok) {
+            committed(filename, *hash, handedIn, ok);
+        });
+}
+
+// Runs on the committing thread; false if the snapshot could not be built or
+// matches the last one committed
+bool WriteBehindCache::build(const std::string& filename, const Snapshot& snapshot, std::string& data, std::uint64_t& hash) {
+    try {
+        data = snapshot();
+        hash = contentHash(data);
+    } catch (const std::exception& e) {
+        std::cerr << "Failed to serialise " << filename << ": " << e.what() << std::endl;
+        std::lock_guard<std::mutex> lock(stateMutex);
+        failed.insert(filename);
+        counters.failed++;
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(stateMutex);
+    std::uint64_t* previous = lastHash.find(filename);
+    if (previous && *previous == hash) {
+        counters.unchanged++;
+        return false;
+    }
+    return true;
+}
+
+// Runs on the committing thread once GroupCommit has written (or failed to
+// write) a snapshot built by build()
+void WriteBehindCache::committed(const std::string& filename, std::uint64_t hash, long long handedIn, bool ok) {
+    std::lock_guard<std::mutex> lock(stateMutex);
+    if (!ok) {
+        // The file's content is unknown now; the next save must be written
+        lastHash.erase(filename);
+        counters.failed++;
+        return;
+    }
+    counters.written++;
+    // A journal append or direct write since the hand-off makes the file
+    // differ from this snapshot
+    if (generation[filename] == handedIn) lastHash[filename] = hash;
+}
@@ -1,11 +1,21 @@
 #include <iostream>
 #include <limits>
+#include <filesystem>
+#include <string>
 #include "functions/PlayerRegistration.hpp"
 #include "functions/SpectatorRegistration.hpp"
 #include "functions/GameResultLogger.hpp"
 #include "functions/TournamentManager.hpp"
 #include "manager/Task2Manager.hpp"
 #include "manager/Task1Manager.hpp"
+#include "helper/JsonWriter.hpp"
+#include "helper/SnapshotFile.hpp"
+#include "helper/JsonLoader.hpp"
+#include "helper/StartupLoader.hpp"
+
+// Must stay first: parses the data files below in parallel so their
+// constructors copy the prefetched lists instead of parsing one by one
+StartupLoader startupLoader;
 
 PlayerRegistration playerReg;
 SpectatorRegistration spectatorReg; 
@@ -14,18 +24,41 @@ TournamentManager tournamentManager; // Global tournament manager instance
 Task1Manager task1Manager(tournamentManager); // Global Task1Manager instance
 Task2Manager task2Manager(tournamentManager, playerReg); // Global Task2Manager instance
 
-PriorityQueue<Player> checkInQueue;
+CheckInQueue checkInQueue;
 
 
 void handleMatchScheduling();
 void handleSpectatorQueue();
 void handleResultLogging();
 void handleTask2Manager();
+int convertDataFiles(StorageFormat format, int fileCount, char* files[]);
+
+// Command line:
+//   --storage <json|msgpack|cbor>            format for files saved this run
+//   --convert <json|msgpack|cbor> [file...]  re-encode files (default: data/*.json) and exit
+int main(int argc, char* argv[]) {
+    // Every global has loaded by now; release the prefetched copies
+    JsonLoader::clearPrefetched();
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        StorageFormat format;
+        if ((arg == "--storage" || arg == "--convert") && i + 1 < argc && SnapshotFile::parseFormatName(argv[i + 1], format)) {
+            if (arg == "--convert") {
+                return convertDataFiles(format, argc - i - 2, argv + i + 2);
+            }
+            JsonWriter::setStorageFormat(format);
+            i++;
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--storage json|msgpack|cbor] [--convert json|msgpack|cbor [file...]]\n";
+            return 1;
+        }
+    }
 
-int main() {
     int choice;
 
     do {
+        JsonWriter::reportFailedSaves();
         std::cout << "\n=== APUEC Management System ===\n";
         std::cout << "1. Match Scheduling & Player Progression\n";
         std::cout << "2. Tournament Registration & Player Queueing\n";
@@ -63,6 +96,35 @@ int main() {
     return 0;
 }
 
+int convertDataFiles(StorageFormat format, int fileCount, char* files[]) {
+    DynamicArray<std::string> targets;
+    for (int i = 0; i < fileCount; i++) {
+        targets.push_back(files[i]);
+    }
+    if (targets.empty()) {
+        std::error_code ec;
+        for (const auto& entry : std::filesystem::directory_iterator("data", ec)) {
+            if (entry.is_regular_file() && entry.path().extension() == ".json") {
+                targets.push_back(entry.path().string());
+            }
+        }
+    }
+
+    int failed = 0;
+    for (const std::string& file : targets) {
+        std::error_code ec;
+        std::uintmax_t before = std::filesystem::file_size(file, ec);
+        if (ec || !JsonWriter::convertFile(file, format)) {
+            std::cerr << "Could not convert " << file << "\n";
+            failed++;
+            continue;
+        }
+        std::cout << file << ": " << before << " -> " << std::filesystem::file_size(file, ec)
+                  << " bytes (" << SnapshotFile::formatName(format) << ")\n";
+    }
+    return failed == 0 ? 0 : 1;
+}
+
 void handleTask2Manager() {
     task2Manager.runTournamentRegistrationSystem();
 }
@@ -80,6 +142,7 @@ void handleMatchScheduling() {
 void handleSpectatorQueue() {
     int choice;
     do {
+        JsonWriter::reportFailedSaves();
         std::cout << "\n-- Spectator Management Menu --\n";
         std::cout << "1. Register Spectator\n";
         std::cout << "2. Check-in Spectator\n";
@@ -117,11 +180,13 @@ void handleResultLogging() {
     int choice;
     
     do {
+        JsonWriter::reportFailedSaves();
         std::cout << "\n-- Game Result Menu --\n";
         std::cout << "1. Display All Loaded Results\n";
         std::cout << "2. Search for Player\n";
         std::cout << "3. Search for Tournament\n";
         std::cout << "4. Search Champion Statistics\n";
+        std::cout << "5. Reload Results From Disk\n";
         std::cout << "0. Back to Main Menu\n";
         std::cout << "Select an option: ";
         
@@ -166,17 +231,15 @@ void handleResultLogging() {
                 std::cout << "Enter Champion name to search: ";
                 std::string championName;
                 std::cin >> championName;
-                
-                // Show champion-specific statistics (data already loaded)
-                std::cout << "\n=== STATISTICS FOR CHAMPION: " << championName << " ===\n";
-                std::cout << "Searching for matches where " << championName << " was played...\n\n";
-                
-                // Show favorite champions to see if the searched champion appears
-                logger.displayPlayerFavoriteChampions();
-                std::cout << "\nNote: The table above shows each player's most-used champion.\n";
-                std::cout << "If " << championName << " appears as someone's favorite, they use it frequently.\n";
+
+                // Record, matchups and top players for the champion (data already loaded)
+                logger.displayChampionStatistics(championName);
                 break;
             }
+            case 5:
+                logger.refreshResults();
+                logger.displayResultStoreStats();
+                break;
             case 0:
                 break;
             default:
@@ -1,6 +1,7 @@
 #include "manager/Task1Manager.hpp"
 #include "helper/JsonLoader.hpp"
 #include "helper/JsonWriter.hpp"
+#include "helper/ResultEvents.hpp"
 #include "functions/GameResultLogger.hpp"
 #include "structures/DoublyLinkedList.hpp"
 #include <iostream>
@@ -9,7 +10,7 @@
 #include <cstdio>
 
 Task1Manager::Task1Manager(TournamentManager& tm) 
-    : tournamentManager(tm), currentTournamentId("") {
+    : tournamentManager(tm), currentTournamentId(""), nextResultNumber(0) {
     // Load existing matches if available
     allMatches = loadMatchesFromFile();
 }
@@ -33,7 +34,7 @@ void Task1Manager::startMatchScheduling() {
     
     // Handle Finals or Completed tournaments - offer restart option
     if (currentStage == TournamentStage::Finals || currentStage == TournamentStage::Completed) {
-        std::cout << "Tournament is currently at " << MatchScheduler::stageToString(currentStage) 
+        std::cout << "Tournament is currently at " << toString(currentStage) 
                   << " stage.\n";
         std::cout << "Do you want to restart the tournament matchmaking? This will:\n";
         std::cout << "  - Clear all existing matches and results\n";
@@ -64,6 +65,7 @@ void Task1Manager::startMatchScheduling() {
             try {
                 DoublyLinkedList<Result> emptyResults;
                 JsonWriter::writeAllResults(emptyResults, "data/results.json");
+                nextResultNumber = 0;
                 std::cout << "Cleared results.json successfully.\n";
             } catch (const std::exception& e) {
                 std::cout << "Warning: Could not clear results.json: " << e.what() << "\n";
@@ -79,7 +81,7 @@ void Task1Manager::startMatchScheduling() {
             return;
         }
     } else if (currentStage != TournamentStage::Registration && currentStage != TournamentStage::Qualifiers) {
-        std::cout << "Tournament is already at " << MatchScheduler::stageToString(currentStage) 
+        std::cout << "Tournament is already at " << toString(currentStage) 
                   << " stage. Initial match scheduling is not allowed.\n";
         std::cout << "Use 'Advance to Next Stage' option to continue tournament progression.\n";
         return;
@@ -177,10 +179,10 @@ DynamicArray<Match> Task1Manager::scheduleQualifiers(const DynamicArray<Player>&
 }
 
 DynamicArray<Match> Task1Manager::scheduleNextStage(TournamentStage stage, const DynamicArray<Player>& winners) {
-    std::cout << "\n--- SCHEDULING " << MatchScheduler::stageToString(stage) << " MATCHES ---\n";
+    std::cout << "\n--- SCHEDULING " << toString(stage) << " MATCHES ---\n";
     
     if (!canAdvanceToNextStage(stage, winners.getSize())) {
-        std::cout << "Cannot advance to " << MatchScheduler::stageToString(stage) 
+        std::cout << "Cannot advance to " << toString(stage) 
                   << " with " << winners.getSize() << " players.\n";
         return DynamicArray<Match>();
     }
@@ -188,7 +190,7 @@ DynamicArray<Match> Task1Manager::scheduleNextStage(TournamentStage stage, const
     DynamicArray<Match> stageMatches = MatchScheduler::scheduleStageMatches(winners, stage, currentTournamentId);
     
     if (!stageMatches.empty()) {
-        std::cout << MatchScheduler::stageToString(stage) << " matches scheduled successfully:\n";
+        std::cout << toString(stage) << " matches scheduled successfully:\n";
         MatchScheduler::displayMatchesByStage(stageMatches, stage);
         
         // Add to main matches collection
@@ -200,14 +202,14 @@ DynamicArray<Match> Task1Manager::scheduleNextStage(TournamentStage stage, const
         saveMatchesToFile(allMatches);
         
         // Automatically simulate the matches to determine results
-        std::cout << "\n--- AUTO-SIMULATING " << MatchScheduler::stageToString(stage) << " MATCHES ---\n";
+        std::cout << "\n--- AUTO-SIMULATING " << toString(stage) << " MATCHES ---\n";
         DynamicArray<Player> stageWinners = simulateMatchResults(stageMatches, winners);
         
         // Update advanced players with the winners from this stage
         if (!stageWinners.empty()) {
             advancedPlayers = stageWinners;
             std::cout << "Stage simulation complete. " << stageWinners.getSize() 
-                      << " players advanced from " << MatchScheduler::stageToString(stage) << "\n";
+                      << " players advanced from " << toString(stage) << "\n";
         }
     }
     
@@ -267,8 +269,8 @@ DynamicArray<Player> Task1Manager::simulateMatchResults(const DynamicArray<Match
             std::cout << "Match " << matches[i].id << ": " 
                       << winner.name << " wins vs " 
                       << (player1Wins ? player2.name : player1.name) 
-                      << " (Champions: " << JsonWriter::championToString(championP1) 
-                      << " vs " << JsonWriter::championToString(championP2) << ")\n";
+                      << " (Champions: " << toString(championP1) 
+                      << " vs " << toString(championP2) << ")\n";
             
             // Log the result by creating a Result object and saving to results.json
             try {
@@ -319,7 +321,7 @@ void Task1Manager::advanceToNextStage(const DynamicArray<Match>& currentMatches)
     if (!nextStageMatches.empty()) {
         advancedPlayers = winners;
         std::cout << "Successfully advanced " << winners.getSize() 
-                  << " players to " << MatchScheduler::stageToString(nextStage) << "\n";
+                  << " players to " << toString(nextStage) << "\n";
     }
 }
 
@@ -372,7 +374,7 @@ void Task1Manager::displayCurrentBracket() const {
     
     // Show current tournament stage
     TournamentStage currentStage = determineCurrentStage();
-    std::cout << "Current Tournament Stage: " << MatchScheduler::stageToString(currentStage) << "\n\n";
+    std::cout << "Current Tournament Stage: " << toString(currentStage) << "\n\n";
     
     MatchScheduler::displayTournamentBracket(allMatches);
     
@@ -393,9 +395,9 @@ void Task1Manager::displayCurrentBracket() const {
             
             if (!currentStageMatches.empty() && currentStage != TournamentStage::Qualifiers) {
                 // We have matches for current stage - show the winners who advanced
-                std::cout << "\n" << MatchScheduler::stageToString(currentStage) 
+                std::cout << "\n" << toString(currentStage) 
                           << " matches completed. Winners advancing to " 
-                          << MatchScheduler::stageToString(nextStage) << ": " 
+                          << toString(nextStage) << ": " 
                           << advancedPlayers.getSize() << "\n";
                 for (int i = 0; i < advancedPlayers.getSize(); ++i) {
                     std::cout << "  " << (i + 1) << ". " << advancedPlayers[i].name 
@@ -406,10 +408,10 @@ void Task1Manager::displayCurrentBracket() const {
                     std::cout << ")\n";
                 }
                 std::cout << "Use 'Advance to Next Stage' to proceed to " 
-                          << MatchScheduler::stageToString(nextStage) << ".\n";
+                          << toString(nextStage) << ".\n";
             } else {
                 // No current stage matches or already completed - show qualified players for next stage
-                std::cout << "\nPlayers qualified for " << MatchScheduler::stageToString(nextStage) 
+                std::cout << "\nPlayers qualified for " << toString(nextStage) 
                           << ": " << advancedPlayers.getSize() << "\n";
                 for (int i = 0; i < advancedPlayers.getSize(); ++i) {
                     std::cout << "  " << (i + 1) << ". " << advancedPlayers[i].name 
@@ -425,12 +427,12 @@ void Task1Manager::displayCurrentBracket() const {
 }
 
 void Task1Manager::displayStageResults(TournamentStage stage) const {
-    std::cout << "\n=== " << MatchScheduler::stageToString(stage) << " RESULTS ===\n";
+    std::cout << "\n=== " << toString(stage) << " RESULTS ===\n";
     
     DynamicArray<Match> stageMatches = getMatchesByStage(stage);
     
     if (stageMatches.empty()) {
-        std::cout << "No matches found for " << MatchScheduler::stageToString(stage) << "\n";
+        std::cout << "No matches found for " << toString(stage) << "\n";
         return;
     }
     
@@ -465,10 +467,9 @@ void Task1Manager::displayStageResults(TournamentStage stage) const {
         
         // Find the corresponding result
         Result* matchResult = nullptr;
-        for (int j = 0; j < results.getSize(); ++j) {
-            Result* result = results.get(j);
-            if (result && result->matchId == match.id) {
-                matchResult = result;
+        for (Result& result : results) {
+            if (result.matchId == match.id) {
+                matchResult = &result;
                 break;
             }
         }
@@ -493,9 +494,9 @@ void Task1Manager::displayStageResults(TournamentStage stage) const {
         // Display match result
         if (matchResult) {
             std::cout << "Match " << match.id << ": " << player1Name << " (" 
-                      << JsonWriter::championToString(matchResult->championsP1) << ") vs " 
+                      << toString(matchResult->championsP1) << ") vs " 
                       << player2Name << " (" 
-                      << JsonWriter::championToString(matchResult->championsP2) << ")\n";
+                      << toString(matchResult->championsP2) << ")\n";
             std::cout << "         Winner: " << winnerName << " (Result ID: " << matchResult->id << ")\n";
         } else {
             std::cout << "Match " << match.id << ": " << player1Name 
@@ -503,7 +504,7 @@ void Task1Manager::displayStageResults(TournamentStage stage) const {
         }
     }
     
-    std::cout << "Total matches in " << MatchScheduler::stageToString(stage) << ": " << stageMatches.getSize() << "\n";
+    std::cout << "Total matches in " << toString(stage) << ": " << stageMatches.getSize() << "\n";
 }
 
 void Task1Manager::displayPlayerProgression() const {
@@ -538,7 +539,7 @@ void Task1Manager::displayPlayerProgression() const {
     std::cout << "\nStage Progression:\n";
     for (int i = 0; i < stages.getSize(); ++i) {
         DynamicArray<Match> stageMatches = getMatchesByStage(stages[i]);
-        std::cout << "  " << MatchScheduler::stageToString(stages[i]) 
+        std::cout << "  " << toString(stages[i]) 
                   << ": " << stageMatches.getSize() << " matches\n";
     }
 }
@@ -549,7 +550,7 @@ void Task1Manager::displayTournamentSummary() const {
     Tournament* activeTournament = tournamentManager.getRegisteringTournament();
     if (activeTournament) {
         std::cout << "Tournament: " << activeTournament->name << "\n";
-        std::cout << "Stage: " << MatchScheduler::stageToString(activeTournament->stage) << "\n";
+        std::cout << "Stage: " << toString(activeTournament->stage) << "\n";
         std::cout << "Location: " << activeTournament->location << "\n\n";
     }
     
@@ -577,11 +578,8 @@ DynamicArray<Match> Task1Manager::loadMatchesFromFile(const std::string& filenam
         auto matchesList = JsonLoader::loadMatches(filename);
         DynamicArray<Match> matches;
         
-        for (int i = 0; i < matchesList.getSize(); ++i) {
-            Match* match = matchesList.get(i);
-            if (match) {
-                matches.push_back(*match);
-            }
+        for (const Match& match : matchesList) {
+            matches.push_back(match);
         }
         
         if (!matches.empty()) {
@@ -596,6 +594,7 @@ DynamicArray<Match> Task1Manager::loadMatchesFromFile(const std::string& filenam
 }
 
 void Task1Manager::displayMenu() const {
+    JsonWriter::reportFailedSaves();
     std::cout << "\n=== MATCH SCHEDULING & PLAYER PROGRESSION MENU ===\n";
     std::cout << "1. Start Match Scheduling\n";
     std::cout << "2. Display Current Tournament Bracket\n";
@@ -657,11 +656,11 @@ void Task1Manager::runMatchSchedulingSystem() {
                 
                 TournamentStage nextStage = getNextStage(currentStage);
                 if (nextStage == currentStage && currentStage != TournamentStage::Finals) {
-                    std::cout << "Cannot advance further from " << MatchScheduler::stageToString(currentStage) << "\n";
+                    std::cout << "Cannot advance further from " << toString(currentStage) << "\n";
                     break;
                 }
                 
-                std::cout << "Current stage: " << MatchScheduler::stageToString(currentStage) << "\n";
+                std::cout << "Current stage: " << toString(currentStage) << "\n";
                 
                 // Special handling for finals
                 if (currentStage == TournamentStage::Finals) {
@@ -675,12 +674,12 @@ void Task1Manager::runMatchSchedulingSystem() {
                         std::cout << "Failed to complete tournament.\n";
                     }
                 } else {
-                    std::cout << "Advancing to: " << MatchScheduler::stageToString(nextStage) << "\n";
+                    std::cout << "Advancing to: " << toString(nextStage) << "\n";
                     bool advancementSuccess = automaticAdvanceToNextStage(currentStage, nextStage);
                     
                     if (advancementSuccess) {
                         updateTournamentStage(nextStage);
-                        std::cout << "Successfully advanced tournament to " << MatchScheduler::stageToString(nextStage) << "!\n";
+                        std::cout << "Successfully advanced tournament to " << toString(nextStage) << "!\n";
                     } else {
                         std::cout << "Failed to advance tournament stage.\n";
                     }
@@ -745,6 +744,7 @@ void Task1Manager::clearAllMatches() {
     try {
         DoublyLinkedList<Result> emptyResults;
         JsonWriter::writeAllResults(emptyResults, "data/results.json");
+        nextResultNumber = 0;
         std::cout << "Cleared results.json file.\n";
     } catch (const std::exception& e) {
         std::cout << "Warning: Could not clear results.json: " << e.what() << "\n";
@@ -776,20 +776,13 @@ bool Task1Manager::hasScheduledMatches() const {
 
 void Task1Manager::saveResultToFile(const Result& result, const std::string& filename) {
     try {
-        // Load existing results
-        DoublyLinkedList<Result> resultsList;
-        try {
-            resultsList = JsonLoader::loadResults(filename);
-        } catch (const std::exception&) {
-            // File might not exist yet, that's okay
+        // Journaled append: no load + rewrite of the whole results file
+        if (JsonWriter::appendResult(result, filename)) {
+            std::cout << "Saved match result " << result.id << " to " << filename << "\n";
+            ResultEvents::publish(filename, result);
+        } else {
+            std::cout << "Error saving result " << result.id << " to " << filename << "\n";
         }
-        
-        // Add new result
-        resultsList.append(result);
-        
-        // Save updated results
-        JsonWriter::writeAllResults(resultsList, filename);
-        std::cout << "Saved match result " << result.id << " to " << filename << "\n";
     } catch (const std::exception& e) {
         std::cout << "Error saving result: " << e.what() << "\n";
     }
@@ -815,38 +808,33 @@ Champion Task1Manager::getRandomChampion(std::mt19937& gen) const {
 }
 
 std::string Task1Manager::generateUniqueResultId() const {
-    // Load existing results to get the next available ID
-    try {
-        DoublyLinkedList<Result> existingResults = JsonLoader::loadResults("data/results.json");
-        int nextId = existingResults.getSize() + 1;
-        std::cout << "Generating unique result ID starting from: " << nextId << "\n";
-        // Ensure uniqueness by checking if ID already exists
-        bool idExists = true;
-        while (idExists) {
-            idExists = false;
-            // Format as R00000
-            char candidateId[7];
-            std::sprintf(candidateId, "R%05d", nextId);
-            std::string candidateIdStr(candidateId);
-            
-            for (int i = 0; i < existingResults.getSize(); ++i) {
-                Result* result = existingResults.get(i);
-                if (result && result->id == candidateIdStr) {
-                    idExists = true;
-                    nextId++;
-                    break;
+    // Read results.json once, then count up from the highest ID seen
+    if (nextResultNumber == 0) {
+        nextResultNumber = 1;
+        try {
+            DoublyLinkedList<Result> existingResults = JsonLoader::loadResults("data/results.json");
+            int highest = existingResults.getSize();
+            for (const Result& result : existingResults) {
+                if (result.id.size() > 1 && result.id[0] == 'R') {
+                    try {
+                        int number = std::stoi(result.id.substr(1));
+                        if (number > highest) highest = number;
+                    } catch (const std::exception&) {
+                        // Not an R-number, cannot collide with one
+                    }
                 }
             }
+            nextResultNumber = highest + 1;
+            std::cout << "Generating unique result ID starting from: " << nextResultNumber << "\n";
+        } catch (const std::exception&) {
+            // If file doesn't exist or can't be loaded, start with ID "R00001"
         }
-        
-        // Format final ID as R00000
-        char finalId[7];
-        std::sprintf(finalId, "R%05d", nextId);
-        return std::string(finalId);
-    } catch (const std::exception&) {
-        // If file doesn't exist or can't be loaded, start with ID "R00001"
-        return "R00001";
     }
+
+    // Format as R00000
+    char resultId[16];
+    std::snprintf(resultId, sizeof(resultId), "R%05d", nextResultNumber++);
+    return std::string(resultId);
 }
 
 DynamicArray<Player> Task1Manager::simulateGroupStageAndGetWinners(const DynamicArray<Match>& matches, const DynamicArray<Player>& players) {
@@ -997,34 +985,34 @@ bool Task1Manager::automaticAdvanceToNextStage(TournamentStage currentStage, Tou
     // The current stage matches should already be simulated, so advancedPlayers contains the winners
     
     if (advancedPlayers.empty()) {
-        std::cout << "No advanced players found to proceed to " << MatchScheduler::stageToString(nextStage) << "\n";
+        std::cout << "No advanced players found to proceed to " << toString(nextStage) << "\n";
         return false;
     }
     
     // Validate number of winners for next stage
     int requiredPlayers = getRequiredPlayersForStage(nextStage);
     if (advancedPlayers.getSize() < requiredPlayers) {
-        std::cout << "Not enough players for " << MatchScheduler::stageToString(nextStage) 
+        std::cout << "Not enough players for " << toString(nextStage) 
                   << ". Required: " << requiredPlayers << ", Got: " << advancedPlayers.getSize() << "\n";
         return false;
     }
     
     std::cout << "Advancing " << advancedPlayers.getSize() << " players from " 
-              << MatchScheduler::stageToString(currentStage) << " to " 
-              << MatchScheduler::stageToString(nextStage) << "\n";
+              << toString(currentStage) << " to " 
+              << toString(nextStage) << "\n";
     
     // Schedule next stage matches (this will also auto-simulate them)
     DynamicArray<Match> nextStageMatches = scheduleNextStage(nextStage, advancedPlayers);
     
     if (nextStageMatches.empty()) {
-        std::cout << "Failed to schedule " << MatchScheduler::stageToString(nextStage) << " matches\n";
+        std::cout << "Failed to schedule " << toString(nextStage) << " matches\n";
         return false;
     }
     
     std::cout << "Successfully scheduled and simulated " << nextStageMatches.getSize() 
-              << " matches for " << MatchScheduler::stageToString(nextStage) << "\n";
+              << " matches for " << toString(nextStage) << "\n";
     std::cout << advancedPlayers.getSize() << " players advanced from " 
-              << MatchScheduler::stageToString(nextStage) << "\n";
+              << toString(nextStage) << "\n";
     
     return true;
 }
@@ -1034,7 +1022,7 @@ void Task1Manager::updateTournamentStage(TournamentStage newStage) {
     if (activeTournament) {
         activeTournament->stage = newStage;
         std::cout << "Updated tournament '" << activeTournament->name 
-                  << "' stage to " << MatchScheduler::stageToString(newStage) << "\n";
+                  << "' stage to " << toString(newStage) << "\n";
         
         // Save the updated tournament (this would typically involve calling a save method)
         // For now, just log the update
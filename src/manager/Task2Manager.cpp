@@ -39,7 +39,7 @@ void Task2Manager::displayCheckInQueue() {
     playerRegistration.displayCheckInQueue();
 }
 
-PriorityQueue<Player> Task2Manager::endCurrentTournamentRegistration() {
+CheckInQueue Task2Manager::endCurrentTournamentRegistration() {
     
     int totalCheckedInPlayers = playerRegistration.getTotalCheckedInPlayers();
     
@@ -50,14 +50,14 @@ PriorityQueue<Player> Task2Manager::endCurrentTournamentRegistration() {
 
     if (!success) {
         std::cout << "Failed to end tournament registration.\n";
-        return PriorityQueue<Player>(); // Return empty queue
+        return CheckInQueue(); // Return empty queue
     }
 
-    PriorityQueue<Player> finalQueue = playerRegistration.getCheckInQueue();
+    CheckInQueue finalQueue = playerRegistration.getCheckInQueue();
     // Save the current queue to file
     if (!JsonWriter::writeAllCheckedInPlayer(finalQueue, "data/checked_in_players.json")) {
         std::cout << "Failed to save check-in queue to file.\n";
-        return PriorityQueue<Player>(); // Return empty queue
+        return CheckInQueue(); // Return empty queue
     }
     
     // Return the check-in queue
@@ -65,6 +65,7 @@ PriorityQueue<Player> Task2Manager::endCurrentTournamentRegistration() {
 }
 
 void Task2Manager::displayMenu() {
+    JsonWriter::reportFailedSaves();
     std::cout << "\n=== TASK 2: TOURNAMENT REGISTRATION & PLAYER QUEUEING ===\n";
     std::cout << "1. Create New Tournament\n";
     std::cout << "2. View Tournament Details\n";
@@ -115,7 +116,7 @@ int Task2Manager::handleMenuChoice() {
             displayCheckInQueue();
             break;
         case 9: {
-            PriorityQueue<Player> finalQueue = endCurrentTournamentRegistration();
+            CheckInQueue finalQueue = endCurrentTournamentRegistration();
             if (finalQueue.isEmpty()) {
                 std::cout << "Ending tournament registration failed. No players checked in.\n";
                 break;
@@ -13,11 +13,10 @@ PlayerRegistration::PlayerRegistration() : nextPlayerId(1), registrationCount(0)
         int maxId = 0;
         
         // Find the highest existing ID number
-        for (int i = 0; i < allPlayers.getSize(); i++) {
-            Player* player = allPlayers.get(i);
-            if (player && !player->id.empty() && player->id.length() >= 2) {
+        for (const Player& player : allPlayers) {
+            if (!player.id.empty() && player.id.length() >= 2) {
                 // Extract numeric part from "P00000" format
-                std::string numericPart = player->id.substr(1);
+                std::string numericPart = player.id.substr(1);
                 try {
                     int id = std::stoi(numericPart);
                     if (id > maxId) {
@@ -42,6 +41,7 @@ PlayerRegistration::PlayerRegistration() : nextPlayerId(1), registrationCount(0)
         std::cerr << "Error loading registered players: " << e.what() << std::endl;
         registeredPlayers.clear();
     }
+    rebuildRegisteredIndex();
 
     // Load existing check-in queue
     try {
@@ -114,6 +114,7 @@ void PlayerRegistration::registerPlayer() {
     }
     
     registeredPlayers.append(player);
+    registeredById.insert(player.id, --registeredPlayers.end());
     std::cout << "Player registered successfully (Registration #" << registrationCount << ")" << std::endl;
     std::cout << "Status - Early Bird: " << (player.isEarlyBird ? "Yes" : "No") 
               << ", Wildcard: " << (player.isWildcard ? "Yes" : "No")
@@ -233,17 +234,13 @@ void PlayerRegistration::unregisterPlayer() {
     std::cin.ignore();
     
     
-    bool found = false;
     // Search and remove from registered players list
-    for (int i = 0; i < registeredPlayers.getSize(); i++) {
-        Player* currentPlayer = registeredPlayers.get(i);
-        if (currentPlayer && currentPlayer->id == playerId) {
-            found = true;
-            std::cout << "Player " << currentPlayer->name << " (ID: " << playerId << ") has been unregistered.\n";
-            registeredPlayers.removeAt(i);
-            registrationCount--;
-            break;
-        }
+    auto* registered = registeredById.find(playerId);
+    bool found = registered != nullptr;
+    if (found) {
+        std::cout << "Player " << (*registered)->name << " (ID: " << playerId << ") has been unregistered.\n";
+        eraseRegistered(*registered);
+        registrationCount--;
     }
     
     if (!found) {
@@ -270,72 +267,33 @@ void PlayerRegistration::withdrawPlayer() {
     std::cin >> playerId;
     std::cin.ignore();
     
-    Player* withdrawingPlayer = nullptr;
-    bool wasEarlyBird = false;
-    bool wasWildcard = false;
-    bool wasLate = false;
-    bool wasRegular = false;
-    
     // Find the withdrawing player in the check-in queue
-    for (int i = 0; i < checkInQueue.getSize(); i++) {
-        // We need to get the player from the queue - but PriorityQueue doesn't have direct access
-        // So we'll check during the queue reconstruction process
-    }
-    
-    // We'll find the player during the queue reconstruction
-    bool playerFound = false;
-    
-    // Create a new check-in queue without the withdrawing player
-    PriorityQueue<Player> newCheckInQueue;
-    
-    // Get all players from current check-in queue
-    if (!checkInQueue.isEmpty()) {
-        int queueSize = checkInQueue.getSize();
-        Player* players = new Player[queueSize];
-        int* priorities = new int[queueSize];
-        int count = 0;
-        
-        checkInQueue.getAllItemsWithPriority(players, priorities, count);
-        
-        // Find the withdrawing player and get their details
-        for (int i = 0; i < count; i++) {
-            if (players[i].id == playerId) {
-                withdrawingPlayer = &players[i];
-                playerFound = true;
-                // Store the status of the withdrawing player
-                wasEarlyBird = withdrawingPlayer->isEarlyBird;
-                wasWildcard = withdrawingPlayer->isWildcard;
-                wasLate = withdrawingPlayer->isLate;
-                wasRegular = (!wasEarlyBird && !wasWildcard && !wasLate);
-                std::cout << "Withdrawing player: " << withdrawingPlayer->name << " (ID: " << playerId << ")\n";
-            } else {
-                // Re-add all other players to the new queue
-                newCheckInQueue.enqueue(players[i], priorities[i]);
-            }
-        }
-        
-        // Clean up
-        delete[] players;
-        delete[] priorities;
-        
-        // Replace the old queue with the new one
-        checkInQueue = newCheckInQueue;
-    }
-    
-    if (!playerFound) {
+    const Player* queuedPlayer = checkInQueue.find(playerId);
+    if (!queuedPlayer) {
         std::cout << "Player with ID " << playerId << " not found in the check-in queue.\n";
         return;
     }
+
+    // Store the status of the withdrawing player before removing them
+    Player withdrawingPlayer = *queuedPlayer;
+    bool wasEarlyBird = withdrawingPlayer.isEarlyBird;
+    bool wasWildcard = withdrawingPlayer.isWildcard;
+    bool wasLate = withdrawingPlayer.isLate;
+    bool wasRegular = (!wasEarlyBird && !wasWildcard && !wasLate);
+    std::cout << "Withdrawing player: " << withdrawingPlayer.name << " (ID: " << playerId << ")\n";
+
+    checkInQueue.erase(playerId);
     
-    std::cout << "Player " << withdrawingPlayer->name << " has been withdrawn successfully.\n";
+    std::cout << "Player " << withdrawingPlayer.name << " has been withdrawn successfully.\n";
     
     // Update tournament participant count (since player is leaving the tournament)
     if (tournamentManager.hasRegisteringTournament()) {
         tournamentManager.decrementParticipantCount();
     }
     
-    // Display status changes if any occurred
+    // Promote waiting players into the freed status, if any
     if (wasEarlyBird || wasRegular) {
+        handleStatusInheritance(wasEarlyBird, wasRegular);
         std::cout << "Status inheritance has been processed. Check registered players for updates.\n";
     }
     
@@ -354,25 +312,21 @@ void PlayerRegistration::handleStatusInheritance(bool wasEarlyBird, bool wasRegu
     int earlyBirdCount = 0;
     int regularCount = 0;
     
-    for (int i = 0; i < registeredPlayers.getSize(); i++) {
-        Player* player = registeredPlayers.get(i);
-        if (player) {
-            if (player->isEarlyBird) earlyBirdCount++;
-            else if (!player->isWildcard && !player->isLate) regularCount++;
-        }
+    for (const Player& player : registeredPlayers) {
+        if (player.isEarlyBird) earlyBirdCount++;
+        else if (!player.isWildcard && !player.isLate) regularCount++;
     }
     
     // If an early bird withdrew and we have less than 10 early birds
     if (wasEarlyBird && earlyBirdCount < 10) {
         // Find the first regular player (chronologically) to promote
-        for (int i = 0; i < registeredPlayers.getSize(); i++) {
-            Player* player = registeredPlayers.get(i);
-            if (player && !player->isEarlyBird && !player->isWildcard && !player->isLate) {
-                player->isEarlyBird = true;
-                std::cout << "Player " << player->name << " (ID: " << player->id << ") promoted to Early Bird status!\n";
+        for (Player& player : registeredPlayers) {
+            if (!player.isEarlyBird && !player.isWildcard && !player.isLate) {
+                player.isEarlyBird = true;
+                std::cout << "Player " << player.name << " (ID: " << player.id << ") promoted to Early Bird status!\n";
                 
                 // Update their priority in check-in queue if they're checked in
-                updatePlayerPriorityInQueue(player->id, 1);
+                updatePlayerPriorityInQueue(player.id, 1);
                 break;
             }
         }
@@ -381,14 +335,13 @@ void PlayerRegistration::handleStatusInheritance(bool wasEarlyBird, bool wasRegu
     // If a regular player withdrew and we have late players who could be promoted
     if (wasRegular) {
         // Find the first late player to promote to regular
-        for (int i = 0; i < registeredPlayers.getSize(); i++) {
-            Player* player = registeredPlayers.get(i);
-            if (player && player->isLate && !player->isWildcard) {
-                player->isLate = false; // Now becomes regular
-                std::cout << "Player " << player->name << " (ID: " << player->id << ") promoted from Late to Regular status!\n";
+        for (Player& player : registeredPlayers) {
+            if (player.isLate && !player.isWildcard) {
+                player.isLate = false; // Now becomes regular
+                std::cout << "Player " << player.name << " (ID: " << player.id << ") promoted from Late to Regular status!\n";
                 
                 // Update their priority in check-in queue if they're checked in
-                updatePlayerPriorityInQueue(player->id, 2);
+                updatePlayerPriorityInQueue(player.id, 2);
                 break;
             }
         }
@@ -396,33 +349,13 @@ void PlayerRegistration::handleStatusInheritance(bool wasEarlyBird, bool wasRegu
 }
 
 void PlayerRegistration::updatePlayerPriorityInQueue(const std::string& playerId, int newPriority) {
-    // Create a new queue with updated priority
-    PriorityQueue<Player> newQueue;
-    
-    if (!checkInQueue.isEmpty()) {
-        int queueSize = checkInQueue.getSize();
-        Player* players = new Player[queueSize];
-        int* priorities = new int[queueSize];
-        int count = 0;
-        
-        checkInQueue.getAllItemsWithPriority(players, priorities, count);
-        
-        // Re-add all players with updated priority for the specified player
-        for (int i = 0; i < count; i++) {
-            if (players[i].id == playerId) {
-                newQueue.enqueue(players[i], newPriority);
-                std::cout << "Updated priority for " << players[i].name << " to " << newPriority << " in check-in queue.\n";
-            } else {
-                newQueue.enqueue(players[i], priorities[i]);
-            }
-        }
-        
-        // Clean up
-        delete[] players;
-        delete[] priorities;
-        
-        // Replace the old queue
-        checkInQueue = newQueue;
+    // Only players already checked in have a queue entry to update. Copy the
+    // name first: updatePriority() re-sifts the heap, which moves entries.
+    const Player* queuedPlayer = checkInQueue.find(playerId);
+    if (!queuedPlayer) return;
+    std::string playerName = queuedPlayer->name;
+    if (checkInQueue.updatePriority(playerId, newPriority)) {
+        std::cout << "Updated priority for " << playerName << " to " << newPriority << " in check-in queue.\n";
     }
 }
 
@@ -437,16 +370,11 @@ void PlayerRegistration::checkInPlayer() {
         return;
     }
     
-    Player* found = nullptr;
     // Search for player in registered players list
-    for (int i = 0; i < registeredPlayers.getSize(); i++) {
-        Player* currentPlayer = registeredPlayers.get(i);
-        if (currentPlayer && currentPlayer->id == playerId) {
-            found = currentPlayer;
-            break;
-        }
-    }
-    if (found) {
+    auto* registered = registeredById.find(playerId);
+    if (registered) {
+        auto foundIt = *registered;
+        Player* found = &*foundIt;
         std::cout << "Checking in player: " << found->name << " (ID: " << playerId << ")\n";
         // Determine priority based on player flags
         int priority;
@@ -467,16 +395,10 @@ void PlayerRegistration::checkInPlayer() {
         checkInQueue.enqueue(*found, priority);
         std::cout << "Player " << found->name << " (ID: " << playerId << ") checked in successfully!\n";
 
-        // remove from registered players list
-        for (int i = 0; i < registeredPlayers.getSize(); i++) {
-            Player* currentPlayer = registeredPlayers.get(i);
-            if (currentPlayer && currentPlayer->id == playerId) {
-                registeredPlayers.removeAt(i);
-                registrationCount--;
-                break;
-            }
-        }
+        // remove from registered players list (print first, erase frees the node)
         std::cout << "Player " << found->name << " has been removed from registered players list after check-in.\n";
+        eraseRegistered(foundIt);
+        registrationCount--;
         // save registered players immediately after check-in
         saveCurrentRegisteredPlayers();
         
@@ -495,24 +417,21 @@ void PlayerRegistration::checkInAllPlayers() {
     
     std::cout << "Checking in all registered players...\n";
     
-    for (int i = 0; i < registeredPlayers.getSize(); i++) {
-        Player* currentPlayer = registeredPlayers.get(i);
-        if (currentPlayer) {
-            // Determine priority based on player flags
-            int priority;
-            if (currentPlayer->isEarlyBird) {
-                priority = 1; // Highest priority
-            } else if (currentPlayer->isWildcard) {
-                priority = 3; // Wildcard priority
-            } else if (currentPlayer->isLate) {
-                priority = 4; // Lowest priority
-            } else {
-                priority = 2; // Regular priority
-            }
-            
-            checkInQueue.enqueue(*currentPlayer, priority);
-            std::cout << "Checked in: " << currentPlayer->name << " (Priority: " << priority << ")\n";
+    for (Player& currentPlayer : registeredPlayers) {
+        // Determine priority based on player flags
+        int priority;
+        if (currentPlayer.isEarlyBird) {
+            priority = 1; // Highest priority
+        } else if (currentPlayer.isWildcard) {
+            priority = 3; // Wildcard priority
+        } else if (currentPlayer.isLate) {
+            priority = 4; // Lowest priority
+        } else {
+            priority = 2; // Regular priority
         }
+        
+        checkInQueue.enqueue(currentPlayer, priority);
+        std::cout << "Checked in: " << currentPlayer.name << " (Priority: " << priority << ")\n";
     }
     
     std::cout << "All players checked in successfully!\n";
@@ -528,18 +447,15 @@ void PlayerRegistration::displayRegisteredPlayers() {
     }
     
     std::cout << "\n=== REGISTERED PLAYERS ===\n";
-    for (int i = 0; i < registeredPlayers.getSize(); i++) {
-        Player* player = registeredPlayers.get(i);
-        if (player) {
-            std::cout << "Player ID: " << player->id
-                      << ", Name: " << player->name
-                      << ", Age: " << player->age
-                      << ", Gender: " << (player->gender == Gender::Male ? "Male" : "Female")
-                      << ", Early Bird: " << (player->isEarlyBird ? "Yes" : "No")
-                      << ", Wildcard: " << (player->isWildcard ? "Yes" : "No")
-                      << ", Late Registration: " << (player->isLate ? "Yes" : "No")
-                      << std::endl;
-        }
+    for (const Player& player : registeredPlayers) {
+        std::cout << "Player ID: " << player.id
+                  << ", Name: " << player.name
+                  << ", Age: " << player.age
+                  << ", Gender: " << toString(player.gender)
+                  << ", Early Bird: " << (player.isEarlyBird ? "Yes" : "No")
+                  << ", Wildcard: " << (player.isWildcard ? "Yes" : "No")
+                  << ", Late Registration: " << (player.isLate ? "Yes" : "No")
+                  << std::endl;
     }
     std::cout << "Total registered players: " << registeredPlayers.getSize() << std::endl;
 }
@@ -557,7 +473,7 @@ int PlayerRegistration::getTotalCheckedInPlayers() const {
     return checkInQueue.getSize();
 }
 
-PriorityQueue<Player> PlayerRegistration::getCheckInQueue() const {
+CheckInQueue PlayerRegistration::getCheckInQueue() const {
     return checkInQueue;
 }
 
@@ -598,6 +514,7 @@ void PlayerRegistration::saveCurrentCheckInQueue() {
 void PlayerRegistration::clearRegisteredPlayers() {   
     int playerCount = registeredPlayers.getSize();
     registeredPlayers.clear();
+    registeredById.clear();
     registrationCount = 0;
     
     // Update tournament participant count to zero
@@ -621,7 +538,7 @@ void PlayerRegistration::clearCheckInQueue() {
     checkInQueue.clear();
     
     // Clear the temporary check-in queue file
-    PriorityQueue<Player> emptyQueue;
+    CheckInQueue emptyQueue;
     JsonWriter::writeAllCheckedInPlayer(emptyQueue, "data/temp_checkin_queue.json");
 }
 
@@ -643,11 +560,22 @@ std::string PlayerRegistration::getCurrentDate() {
 }
 
 bool PlayerRegistration::isPlayerRegistered(const std::string& playerId) const {
-    for (int i = 0; i < registeredPlayers.getSize(); i++) {
-        Player* player = registeredPlayers.get(i);
-        if (player && player->id == playerId) {
-            return true; // Player is registered
+    return registeredById.contains(playerId);
+}
+
+void PlayerRegistration::rebuildRegisteredIndex() {
+    registeredById.clear();
+    registeredById.reserve(registeredPlayers.getSize());
+    for (auto it = registeredPlayers.begin(); it != registeredPlayers.end(); ++it) {
+        // First occurrence wins, matching a front-to-back search
+        if (!registeredById.contains(it->id)) {
+            registeredById.insert(it->id, it);
         }
     }
-    return false; // Player not found in registered players
+}
+
+// Remove a registered player from the list and the id index together
+void PlayerRegistration::eraseRegistered(DoublyLinkedList<Player>::Iterator position) {
+    registeredById.erase(position->id);
+    registeredPlayers.erase(position);
 }
\ No newline at end of file
@@ -10,7 +10,10 @@
 #include <sstream>
 #include <nlohmann/json.hpp>
 #include "functions/SpectatorRegistration.hpp"
+#include "structures/HashMap.hpp"
 #include "helper/JsonWriter.hpp"
+#include "helper/SnapshotFile.hpp"
+#include "helper/WriteBehindCache.hpp"
 
 using json = nlohmann::json;
 
@@ -24,7 +27,9 @@ SpectatorRegistration::SpectatorRegistration()
         /*generalCapacity*/  150    // 150 general seats
     )),
     dataLoaded(false),
-    nextSpectatorId(1)
+    nextSpectatorId(1),
+    checkInRecords(json::array()),
+    checkInRecordsLoaded(false)
 {
     loadSpectatorsFromJSON("../data/spectators.json");
     loadCheckIns("../data/check_in.json");
@@ -35,38 +40,20 @@ SpectatorRegistration::~SpectatorRegistration() {
 }
 
 void SpectatorRegistration::loadSpectatorsFromJSON(const std::string& filename) {
-    std::ifstream in(filename);
-    if (!in.is_open()) {
+    if (!std::ifstream(filename).is_open()) {
         std::cerr << " Could not open " << filename << "\n";
         return;
     }
     try {
-        json arr; in >> arr; in.close();
-        for (auto &item : arr) {
-            std::string idStr      = item["id"];
-            int         id         = std::stoi(idStr.substr(1));
-            std::string name       = item["name"];
-            Gender      gender     = (item["gender"]=="Female" ? Gender::Female : Gender::Male);
-            std::string email      = item["email"];
-            std::string phone      = item["phoneNum"];
-            std::string typeStr    = item["type"];
-            SpectatorType type      = SpectatorType::Normal;
-            if (typeStr=="VIP")         type = SpectatorType::VIP;
-            else if (typeStr=="Streamer")   type = SpectatorType::Streamer;
-            else if (typeStr=="Influencer") type = SpectatorType::Influencer;
-            else if (typeStr=="Player")     type = SpectatorType::Player;
-            std::string affiliation = item["affiliation"];
-
-            allSpectators.append({ id, name, gender, email, phone, type, affiliation });
-        }
+        // JsonLoader also replays records journaled by appendSpectator
+        allSpectators = JsonLoader::loadSpectators(filename);
         // std::cout << "[INFO] Loaded " << allSpectators.getSize() << " spectators.\n";
         
         // Update nextSpectatorId to be one more than the highest existing ID
         int maxId = 0;
-        for (int i = 0; i < allSpectators.getSize(); ++i) {
-            auto* s = allSpectators.get(i);
-            if (s && s->id > maxId) {
-                maxId = s->id;
+        for (auto& s : allSpectators) {
+            if (s.id > maxId) {
+                maxId = s.id;
             }
         }
         nextSpectatorId = maxId + 1;
@@ -77,36 +64,38 @@ void SpectatorRegistration::loadSpectatorsFromJSON(const std::string& filename)
 }
 
 void SpectatorRegistration::loadCheckIns(const std::string& filename) {
-    std::ifstream in(filename);
-    if (!in.is_open()) {
+    if (!std::ifstream(filename).is_open()) {
         std::cerr << " Could not open " << filename << "; skipping auto-enqueue.\n";
         dataLoaded = true;
         return;
     }
     try {
-        json arr; in >> arr; in.close();
+        json arr;
+        if (!SnapshotFile::read(filename, arr)) return;
+        if (arr.is_array()) {
+            checkInRecords = arr;
+            checkInRecordsLoaded = true;
+        }
+
+        // Index spectators by their check-in formatted ID once, up front
+        HashMap<std::string, Spectator*> spectatorsById(allSpectators.getSize());
+        for (auto& s : allSpectators) {
+            char formattedId[16];
+            snprintf(formattedId, sizeof(formattedId), "S%05d", s.id);
+            if (!spectatorsById.contains(formattedId)) {
+                spectatorsById.insert(formattedId, &s);
+            }
+        }
+
         int count = 0;
         for (auto &obj : arr) {
             if (!obj["checkedIn"].get<bool>()) continue;
             std::string sid = obj["spectatorId"];
             
             // Find spectator by ID
-            Spectator* spectatorPtr = nullptr;
-            for (int i = 0; i < allSpectators.getSize(); ++i) {
-                auto* s = allSpectators.get(i);
-                if (s) {
-                    // Format spectator ID with leading zeros to match check-in format
-                    char formattedId[10];
-                    sprintf(formattedId, "S%05d", s->id);
-                    if (std::string(formattedId) == sid) {
-                        spectatorPtr = s;
-                        break;
-                    }
-                }
-            }
-            
+            Spectator** spectatorPtr = spectatorsById.find(sid);
             if (spectatorPtr) {
-                seatingManager->addToEntryQueue(*spectatorPtr, false);
+                queueForSeating(**spectatorPtr);
                 ++count;
             }
         }
@@ -129,17 +118,16 @@ std::string SpectatorRegistration::getCurrentDateTime() {
 }
 
 void SpectatorRegistration::updateCheckInFile(const Spectator& spectator) {
-    // Load existing check-in data
-    json checkInArray = json::array();
-    std::ifstream inFile("../data/check_in.json");
-    if (inFile.is_open()) {
-        try {
-            inFile >> checkInArray;
-        } catch (...) {
-            checkInArray = json::array();
+    // Load existing check-in data once; afterwards the in-memory copy is current
+    const std::string checkInFile = "../data/check_in.json";
+    if (!checkInRecordsLoaded) {
+        WriteBehindCache::instance().flush(checkInFile);
+        if (!SnapshotFile::read(checkInFile, checkInRecords) || !checkInRecords.is_array()) {
+            checkInRecords = json::array();
         }
-        inFile.close();
+        checkInRecordsLoaded = true;
     }
+    json& checkInArray = checkInRecords;
     
     // Format spectator ID
     char formattedId[10];
@@ -164,10 +152,7 @@ void SpectatorRegistration::updateCheckInFile(const Spectator& spectator) {
         json newEntry;
         newEntry["spectatorId"] = std::string(formattedId);
         newEntry["name"] = spectator.name;
-        newEntry["type"] = (spectator.type == SpectatorType::VIP) ? "VIP" :
-                          (spectator.type == SpectatorType::Streamer) ? "Streamer" :
-                          (spectator.type == SpectatorType::Influencer) ? "Influencer" :
-                          (spectator.type == SpectatorType::Player) ? "Player" : "Normal";
+        newEntry["type"] = toString(spectator.type);
         newEntry["affiliation"] = spectator.affiliation;
         newEntry["checkedIn"] = true;
         auto dateTime = getCurrentDateTime();
@@ -178,15 +163,10 @@ void SpectatorRegistration::updateCheckInFile(const Spectator& spectator) {
         checkInArray.push_back(newEntry);
     }
     
-    // Write back to file
-    std::ofstream outFile("../data/check_in.json");
-    if (outFile.is_open()) {
-        outFile << checkInArray.dump(4);
-        outFile.close();
-        // std::cout << "[INFO] Check-in data saved to file.\n";
-    } else {
-        std::cerr << " Failed to save check-in data to file.\n";
-    }
+    // Written back by the write-behind thread, from a copy
+    WriteBehindCache::instance().markDirty(checkInFile, [checkInArray]() {
+        return SnapshotFile::encode(checkInArray, SnapshotFile::getFormat());
+    });
 }
 
 void SpectatorRegistration::registerSpectator() {
@@ -249,7 +229,7 @@ void SpectatorRegistration::checkInSpectator() {
     Spectator s = *allSpectators.get(choice-1);
     
     // Add to seating queue
-    seatingManager->addToEntryQueue(s, false);
+    queueForSeating(s);
     
     // Save check-in data to file
     updateCheckInFile(s);
@@ -260,6 +240,15 @@ void SpectatorRegistration::checkInSpectator() {
     if (c=='y'||c=='Y') displayQueue();
 }
 
+// Check-ins take the same lock-free path a kiosk thread would. When the
+// ingress is full it is drained first, so arrival order is kept.
+void SpectatorRegistration::queueForSeating(const Spectator& spectator) {
+    if (!seatingManager->submitFromKiosk(spectator)) {
+        seatingManager->drainKioskIngress();
+        seatingManager->addToEntryQueue(spectator, false);
+    }
+}
+
 void SpectatorRegistration::displayQueue() {
     if (!dataLoaded) {
         std::cerr << " No data loaded; aborting seating pass.\n";
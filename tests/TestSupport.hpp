@@ -0,0 +1,64 @@
+#ifndef TEST_SUPPORT_HPP
+#define TEST_SUPPORT_HPP
+
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+
+// Minimal helpers shared by the test and benchmark programs
+
+// Failed CHECKs are counted and reported; the program keeps going so one
+// run shows every failure
+inline int& testFailures() {
+    static int failures = 0;
+    return failures;
+}
+
+#define CHECK(condition)                                                            \
+    do {                                                                            \
+        if (!(condition)) {                                                         \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK failed: "          \
+                      << #condition << std::endl;                                   \
+            testFailures()++;                                                       \
+        }                                                                           \
+    } while (0)
+
+// Exit status for main()
+inline int testResult(const char* name) {
+    if (testFailures() == 0) {
+        std::cout << name << ": all checks passed\n";
+        return 0;
+    }
+    std::cerr << name << ": " << testFailures() << " check(s) failed\n";
+    return 1;
+}
+
+// Wall-clock milliseconds since construction
+class Stopwatch {
+public:
+    Stopwatch() : start(std::chrono::steady_clock::now()) {}
+    double elapsedMs() const {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+private:
+    std::chrono::steady_clock::time_point start;
+};
+
+// Record count from argv[1], or fallback
+inline int countArgument(int argc, char** argv, int fallback) {
+    return argc > 1 ? std::atoi(argv[1]) : fallback;
+}
+
+// Fresh scratch directory under the system temp dir; the programs read and
+// write data/... relative paths, so they chdir into it
+inline std::filesystem::path enterScratchDirectory(const std::string& name) {
+    std::filesystem::path dir = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir / "data");
+    std::filesystem::current_path(dir);
+    return dir;
+}
+
+#endif
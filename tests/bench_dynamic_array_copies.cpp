@@ -0,0 +1,89 @@
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <utility>
+#include "TestSupport.hpp"
+#include "functions/MatchScheduler.hpp"
+#include "structures/DynamicArray.hpp"
+
+// Element copies made by DynamicArray, and heap allocations made by the
+// qualifier scheduler, per operation.
+//
+// Moving is only used when the element's move constructor is noexcept, so
+// an element whose move may throw shows the copy-on-growth cost the array
+// had before it became move-aware; the difference between the two columns
+// is what the move-aware growth saves.
+
+static long long allocations = 0;
+
+void* operator new(std::size_t size) {
+    allocations++;
+    if (void* block = std::malloc(size ? size : 1)) return block;
+    throw std::bad_alloc();
+}
+void operator delete(void* block) noexcept { std::free(block); }
+void operator delete(void* block, std::size_t) noexcept { std::free(block); }
+
+template <bool NoexceptMove>
+struct Counted {
+    static long long copies;
+    std::string payload;
+
+    explicit Counted(int value = 0) : payload("payload-string-" + std::to_string(value)) {}
+    Counted(const Counted& other) : payload(other.payload) { copies++; }
+    Counted(Counted&& other) noexcept(NoexceptMove) : payload(std::move(other.payload)) {}
+    Counted& operator=(const Counted& other) { payload = other.payload; copies++; return *this; }
+    Counted& operator=(Counted&& other) noexcept(NoexceptMove) { payload = std::move(other.payload); return *this; }
+};
+template <bool NoexceptMove>
+long long Counted<NoexceptMove>::copies = 0;
+
+template <bool NoexceptMove>
+static long long growthCopies(int count) {
+    Counted<NoexceptMove>::copies = 0;
+    DynamicArray<Counted<NoexceptMove>> values;
+    for (int i = 0; i < count; ++i) values.emplace_back(i);
+    values.insert(0, Counted<NoexceptMove>(-1));
+    values.erase(count / 2);
+    return Counted<NoexceptMove>::copies;
+}
+
+static DynamicArray<Player> qualifierPlayers() {
+    DynamicArray<Player> players;
+    for (int i = 1; i <= 30; ++i) {
+        std::string id = "P" + std::to_string(1000 + i);
+        players.emplace_back(id, "Player " + std::to_string(i), 20, Gender::Male, id + "@example.com",
+                             "0123456789", i * 37 % 100, i % 3 == 0, false, false, "2025-07-01");
+    }
+    return players;
+}
+
+int main(int argc, char** argv) {
+    int count = countArgument(argc, argv, 100000);
+
+    std::cout << "Element copies growing to " << count << " elements (+1 insert, 1 erase):\n";
+    std::cout << "  copy-on-growth (move may throw): " << growthCopies<false>(count) << "\n";
+    std::cout << "  move-aware (noexcept move):      " << growthCopies<true>(count) << "\n";
+
+    // The scheduler prints its progress; keep it out of the report
+    DynamicArray<Player> players = qualifierPlayers();
+    std::ostringstream sink;
+    std::streambuf* console = std::cout.rdbuf(sink.rdbuf());
+    const int rounds = 200;
+    long long before = allocations;
+    Stopwatch timer;
+    int scheduled = 0;
+    for (int i = 0; i < rounds; ++i) {
+        scheduled = MatchScheduler::scheduleQualifierMatches(players, "T001").getSize();
+        sink.str("");
+    }
+    double ms = timer.elapsedMs();
+    long long perCall = (allocations - before) / rounds;
+    std::cout.rdbuf(console);
+
+    std::cout << "scheduleQualifierMatches, 30 players -> " << scheduled << " matches:\n";
+    std::cout << "  heap allocations per call: " << perCall << "\n";
+    std::cout << "  time per call: " << ms / rounds << " ms\n";
+    return 0;
+}
@@ -0,0 +1,142 @@
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <nlohmann/json.hpp>
+#include "TestSupport.hpp"
+#include "dto/Result.hpp"
+#include "dto/Spectator.hpp"
+#include "helper/DtoCodec.hpp"
+#include "helper/JsonLoader.hpp"
+#include "structures/DoublyLinkedList.hpp"
+#include "structures/DynamicArray.hpp"
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+// Load time and peak memory of the SAX loaders (JsonLoader, DtoCodec)
+// against the json-tree loading they replaced, on generated spectator and
+// result files. Each load runs in its own child process so the peak RSS of
+// one does not hide the next. Usage: bench_json_loading [records]
+
+using json = nlohmann::json;
+
+// The tree-based loaders as JsonLoader had them: parse the whole file,
+// then copy every field out of the tree
+static DoublyLinkedList<Spectator> domLoadSpectators(const std::string& filename) {
+    DoublyLinkedList<Spectator> list;
+    std::ifstream file(filename);
+    json data;
+    file >> data;
+    for (const auto& item : data) {
+        SpectatorType type = enumFromString(item["type"].get<std::string>(), SpectatorType::Normal);
+        std::string idStr = item["id"];
+        int id = idStr.length() > 1 && idStr[0] == 'S' ? std::stoi(idStr.substr(1)) : 0;
+        list.append(Spectator(id, item["name"], item["gender"] == "Male" ? Gender::Male : Gender::Female,
+                              item["email"], item["phoneNum"], type, item["affiliation"]));
+    }
+    return list;
+}
+
+static DoublyLinkedList<Result> domLoadResults(const std::string& filename) {
+    DoublyLinkedList<Result> list;
+    std::ifstream file(filename);
+    json data;
+    file >> data;
+    for (const auto& item : data) {
+        list.append(Result(item["id"].get<std::string>(), item["matchId"].get<std::string>(),
+                           enumFromString(item["championsP1"].get<std::string>(), Champion::NoChampion),
+                           enumFromString(item["championsP2"].get<std::string>(), Champion::NoChampion),
+                           item["winnerId"].get<std::string>()));
+    }
+    return list;
+}
+
+static void writeFile(const std::string& filename, const std::string& bytes) {
+    std::ofstream out(filename, std::ios::binary);
+    out << bytes;
+}
+
+static void generateFiles(int count) {
+    {
+        DynamicArray<Spectator> spectators(count);
+        for (int i = 0; i < count; ++i) {
+            spectators.emplace_back(i + 1, "Spectator " + std::to_string(i), i % 2 ? Gender::Female : Gender::Male,
+                                    "spectator" + std::to_string(i) + "@example.com", "01" + std::to_string(10000000 + i),
+                                    static_cast<SpectatorType>(i % 5), "Platform " + std::to_string(i % 40));
+        }
+        writeFile("data/spectators.json", DtoCodec::encodeArray(spectators, StorageFormat::Json));
+    }
+    DynamicArray<Result> results(count);
+    for (int i = 0; i < count; ++i) {
+        results.emplace_back("R" + std::to_string(i), "M" + std::to_string(i / 2),
+                             static_cast<Champion>(i % 12), static_cast<Champion>((i + 5) % 12),
+                             "P" + std::to_string(i % 1000));
+    }
+    writeFile("data/results.json", DtoCodec::encodeArray(results, StorageFormat::Json));
+}
+
+struct Measurement {
+    double ms;
+    long peakKb; // -1 where it cannot be measured
+};
+
+// Run load in a child process; the child reports its wall time through a
+// pipe and the parent reads the child's peak RSS from wait4
+template <typename Load>
+static Measurement measure(Load load) {
+#ifndef _WIN32
+    int fds[2];
+    if (pipe(fds) != 0) return {0, -1};
+    pid_t pid = fork();
+    if (pid == 0) {
+        close(fds[0]);
+        Stopwatch timer;
+        int loaded = load();
+        double ms = timer.elapsedMs();
+        if (loaded < 0) ms = -1;
+        ssize_t written = write(fds[1], &ms, sizeof ms);
+        _exit(written == sizeof ms ? 0 : 1);
+    }
+    close(fds[1]);
+    double ms = -1;
+    if (read(fds[0], &ms, sizeof ms) != sizeof ms) ms = -1;
+    close(fds[0]);
+    int status = 0;
+    struct rusage usage {};
+    wait4(pid, &status, 0, &usage);
+    return {ms, usage.ru_maxrss};
+#else
+    Stopwatch timer;
+    load();
+    return {timer.elapsedMs(), -1};
+#endif
+}
+
+static void report(const char* label, const Measurement& m, long baselineKb) {
+    std::cout << std::left << std::setw(28) << label << std::right << std::fixed << std::setprecision(1)
+              << std::setw(10) << m.ms << " ms";
+    if (m.peakKb >= 0) {
+        std::cout << std::setw(10) << (m.peakKb - baselineKb) / 1024 << " MB peak";
+    }
+    std::cout << "\n";
+}
+
+int main(int argc, char** argv) {
+    int count = countArgument(argc, argv, 1000000);
+    enterScratchDirectory("esports_bench_json_loading");
+
+    // Generated in a child so the parent (and every later fork) starts small
+    measure([count]() { generateFiles(count); return 0; });
+    long baselineKb = measure([]() { return 0; }).peakKb;
+
+    std::cout << count << " records per file; peak is RSS above an idle child\n";
+    report("spectators  json tree", measure([]() { return domLoadSpectators("data/spectators.json").getSize(); }), baselineKb);
+    report("spectators  SAX", measure([]() { return JsonLoader::loadSpectators("data/spectators.json").getSize(); }), baselineKb);
+    report("results     json tree", measure([]() { return domLoadResults("data/results.json").getSize(); }), baselineKb);
+    report("results     SAX", measure([]() { return JsonLoader::loadResults("data/results.json").getSize(); }), baselineKb);
+    return 0;
+}
@@ -0,0 +1,56 @@
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include "TestSupport.hpp"
+#include "functions/PlayerStatsTable.hpp"
+#include "structures/DynamicArray.hpp"
+
+// PlayerStatsTable at scale: ingesting results the way
+// GameResultLogger::ingestResult does (two findOrAdd + recordMatch per
+// result), then the win-rate ranking and the match-count pass.
+// Usage: bench_player_stats [results] (players = results / 8)
+
+int main(int argc, char** argv) {
+    int resultCount = countArgument(argc, argv, 2000000);
+    int playerCount = resultCount / 8 > 2 ? resultCount / 8 : 2;
+
+    // Ids built up front so only the table is timed
+    DynamicArray<std::string> ids(playerCount);
+    DynamicArray<std::string> names(playerCount);
+    for (int i = 0; i < playerCount; ++i) {
+        ids.push_back("P" + std::to_string(i));
+        names.push_back("Player " + std::to_string(i));
+    }
+
+    PlayerStatsTable table;
+    unsigned int seed = 12345;
+    Stopwatch ingestTimer;
+    for (int i = 0; i < resultCount; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        int player1 = static_cast<int>((seed >> 8) % static_cast<unsigned int>(playerCount));
+        int player2 = (player1 + 1 + static_cast<int>(seed % 7)) % playerCount;
+        bool player1Won = (seed >> 4) & 1;
+
+        int slot1 = table.findOrAdd(ids[player1], names[player1]);
+        int slot2 = table.findOrAdd(ids[player2], names[player2]);
+        table.recordMatch(slot1, player1Won, static_cast<Champion>(i % 12), "2025-01-01", 30.0f);
+        table.recordMatch(slot2, !player1Won, static_cast<Champion>((i + 5) % 12), "2025-01-01", 30.0f);
+    }
+    double ingestMs = ingestTimer.elapsedMs();
+
+    Stopwatch rankTimer;
+    DynamicArray<int> ranking = table.rankByWinRate();
+    double rankMs = rankTimer.elapsedMs();
+
+    Stopwatch sumTimer;
+    long long matches = table.sumTotalMatches();
+    double sumMs = sumTimer.elapsedMs();
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << resultCount << " results, " << table.getSize() << " players\n";
+    std::cout << "ingest          " << std::setw(9) << ingestMs << " ms  ("
+              << std::setprecision(0) << ingestMs * 1e6 / resultCount << " ns per result)\n" << std::setprecision(1);
+    std::cout << "rankByWinRate   " << std::setw(9) << rankMs << " ms  (" << ranking.getSize() << " ranked)\n";
+    std::cout << "sumTotalMatches " << std::setw(9) << sumMs << " ms  (" << matches << ")\n";
+    return matches == 2LL * resultCount ? 0 : 1;
+}
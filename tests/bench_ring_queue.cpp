@@ -0,0 +1,90 @@
+#include <atomic>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include "TestSupport.hpp"
+#include "structures/CircularQueue.hpp"
+#include "structures/DynamicArray.hpp"
+#include "structures/MpmcRingQueue.hpp"
+#include "structures/SpscRingQueue.hpp"
+
+// Throughput of 1, 2, 4 and 8 producer threads feeding one consumer, as
+// kiosks feed SeatingManager: the lock-free MpmcRingQueue against a
+// CircularQueue behind a mutex, and with one producer SpscRingQueue too.
+// Usage: bench_ring_queue [items per producer]
+
+class LockedCircularQueue {
+public:
+    explicit LockedCircularQueue(int size) : queue(size) {}
+
+    bool tryEnqueue(int item) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (queue.isFull()) return false;
+        queue.enqueue(item);
+        return true;
+    }
+
+    bool tryDequeue(int& out) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (queue.isEmpty()) return false;
+        out = queue.dequeue();
+        return true;
+    }
+
+private:
+    std::mutex mutex;
+    CircularQueue<int> queue;
+};
+
+// Millions of items per second through queue
+template <typename Queue>
+static double run(Queue& queue, int producers, int perProducer) {
+    Stopwatch timer;
+    DynamicArray<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.push_back(std::thread([&queue, perProducer]() {
+            for (int i = 0; i < perProducer; ++i) {
+                while (!queue.tryEnqueue(i)) std::this_thread::yield();
+            }
+        }));
+    }
+
+    long long total = static_cast<long long>(producers) * perProducer;
+    long long received = 0;
+    int item;
+    while (received < total) {
+        if (queue.tryDequeue(item)) {
+            received++;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    for (std::thread& thread : threads) thread.join();
+    return total / timer.elapsedMs() / 1000.0;
+}
+
+int main(int argc, char** argv) {
+    int perProducer = countArgument(argc, argv, 1000000);
+    std::cout << perProducer << " items per producer, one consumer, ring of 1024\n";
+    std::cout << std::setw(10) << "Producers" << std::setw(18) << "SPSC (M items/s)" << std::setw(18) << "MPMC (M items/s)"
+              << std::setw(20) << "Mutex (M items/s)" << "\n";
+
+    for (int producers : {1, 2, 4, 8}) {
+        MpmcRingQueue<int> lockFree(1024);
+        LockedCircularQueue locked(1024);
+        double lockFreeRate = run(lockFree, producers, perProducer);
+        double lockedRate = run(locked, producers, perProducer);
+        std::cout << std::fixed << std::setprecision(2) << std::setw(10) << producers;
+
+        // SpscRingQueue only allows one producer
+        if (producers == 1) {
+            SpscRingQueue<int> single(1024);
+            std::cout << std::setw(18) << run(single, producers, perProducer);
+        } else {
+            std::cout << std::setw(18) << "-";
+        }
+        std::cout << std::setw(18) << lockFreeRate << std::setw(20) << lockedRate << "\n";
+    }
+    return 0;
+}
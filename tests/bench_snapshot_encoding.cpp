@@ -0,0 +1,65 @@
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <nlohmann/json.hpp>
+#include "TestSupport.hpp"
+#include "dto/Result.hpp"
+#include "dto/Spectator.hpp"
+#include "helper/DtoCodec.hpp"
+#include "structures/DynamicArray.hpp"
+
+// Whole-file JSON encoding: DtoCodec::encodeArray, which streams each record
+// as text, against building a json array of toJson() objects and calling
+// dump(4) on it as JsonWriter used to. The two outputs are compared byte for
+// byte. Usage: bench_snapshot_encoding [records]
+
+template <typename Container>
+static std::string encodeThroughTree(const Container& records) {
+    nlohmann::json data = nlohmann::json::array();
+    for (const auto& record : records) {
+        data.push_back(DtoCodec::toJson(record));
+    }
+    return data.dump(4);
+}
+
+template <typename Container>
+static bool compare(const char* label, const Container& records) {
+    Stopwatch treeTimer;
+    std::string tree = encodeThroughTree(records);
+    double treeMs = treeTimer.elapsedMs();
+
+    Stopwatch streamTimer;
+    std::string streamed = DtoCodec::encodeArray(records, StorageFormat::Json);
+    double streamMs = streamTimer.elapsedMs();
+
+    bool same = tree == streamed;
+    std::cout << std::left << std::setw(12) << label << std::right << std::fixed << std::setprecision(1)
+              << "json tree + dump(4) " << std::setw(9) << treeMs << " ms   "
+              << "encodeArray " << std::setw(9) << streamMs << " ms   "
+              << (tree.size() >> 20) << " MB, " << (same ? "identical" : "OUTPUT DIFFERS") << "\n";
+    return same;
+}
+
+int main(int argc, char** argv) {
+    int count = countArgument(argc, argv, 1000000);
+
+    bool same = true;
+    {
+        DynamicArray<Spectator> spectators(count);
+        for (int i = 0; i < count; ++i) {
+            spectators.emplace_back(i + 1, "Spectator \"" + std::to_string(i) + "\"", i % 2 ? Gender::Female : Gender::Male,
+                                    "spectator" + std::to_string(i) + "@example.com", "01" + std::to_string(10000000 + i),
+                                    static_cast<SpectatorType>(i % 5), "Platform " + std::to_string(i % 40));
+        }
+        same = compare("spectators", spectators) && same;
+    }
+
+    DynamicArray<Result> results(count);
+    for (int i = 0; i < count; ++i) {
+        results.emplace_back("R" + std::to_string(i), "M" + std::to_string(i / 2),
+                             static_cast<Champion>(i % 12), static_cast<Champion>((i + 5) % 12),
+                             "P" + std::to_string(i % 1000));
+    }
+    same = compare("results", results) && same;
+    return same ? 0 : 1;
+}
@@ -0,0 +1,78 @@
+#include <string>
+#include <utility>
+#include "TestSupport.hpp"
+#include "structures/DynamicArray.hpp"
+
+// Counts copies and moves of every instance
+struct Tracked {
+    static int copies;
+    static int moves;
+    int value;
+
+    explicit Tracked(int value = 0) : value(value) {}
+    Tracked(const Tracked& other) : value(other.value) { copies++; }
+    Tracked(Tracked&& other) noexcept : value(other.value) { moves++; }
+    Tracked& operator=(const Tracked& other) { value = other.value; copies++; return *this; }
+    Tracked& operator=(Tracked&& other) noexcept { value = other.value; moves++; return *this; }
+};
+int Tracked::copies = 0;
+int Tracked::moves = 0;
+
+static DynamicArray<int> range(int count) {
+    DynamicArray<int> values;
+    for (int i = 0; i < count; ++i) values.push_back(i);
+    return values;
+}
+
+static void testSelfAppend() {
+    DynamicArray<int> values = range(5);
+    values.append(values);
+    CHECK(values.getSize() == 10);
+    CHECK(values[5] == 0 && values[9] == 4);
+
+    DynamicArray<int> moved = range(5);
+    moved.append(std::move(moved));
+    CHECK(moved.getSize() == 10);
+    CHECK(moved[4] == 4 && moved[9] == 4);
+}
+
+static void testMoveAppendEmptiesSource() {
+    DynamicArray<std::string> target;
+    target.push_back("a");
+    DynamicArray<std::string> source;
+    source.push_back("b");
+    source.push_back("c");
+    target.append(std::move(source));
+    CHECK(target.getSize() == 3 && target[2] == "c");
+    CHECK(source.empty());
+}
+
+static void testGrowthMovesInsteadOfCopying() {
+    Tracked::copies = 0;
+    DynamicArray<Tracked> values;
+    for (int i = 0; i < 1000; ++i) values.emplace_back(i);
+    values.insert(0, Tracked(-1));
+    values.erase(500);
+    values.shrink_to_fit();
+    DynamicArray<Tracked> taken(std::move(values));
+    CHECK(Tracked::copies == 0);
+    CHECK(taken.getSize() == 1000);
+    CHECK(taken[0].value == -1 && taken[999].value == 999);
+    CHECK(taken.getCapacity() == 1000);
+}
+
+static void testInsertEraseOrder() {
+    DynamicArray<int> values = range(4);
+    values.insert(2, 99);
+    values.erase(0);
+    CHECK(values.getSize() == 4);
+    CHECK(values[0] == 1 && values[1] == 99 && values[2] == 2 && values[3] == 3);
+}
+
+int main() {
+    testSelfAppend();
+    testMoveAppendEmptiesSource();
+    testGrowthMovesInsteadOfCopying();
+    testInsertEraseOrder();
+    return testResult("test_dynamic_array");
+}
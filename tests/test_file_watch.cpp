@@ -0,0 +1,152 @@
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <nlohmann/json.hpp>
+#include "TestSupport.hpp"
+#include "helper/FileWatch.hpp"
+#include "helper/JsonJournal.hpp"
+
+using json = nlohmann::json;
+namespace fs = std::filesystem;
+
+static void writeText(const std::string& path, const std::string& text) {
+    std::ofstream(path, std::ios::binary) << text;
+}
+
+static std::uintmax_t journalEnd(const std::string& filename) {
+    std::error_code ec;
+    std::uintmax_t size = fs::file_size(JsonJournal::journalPath(filename), ec);
+    return ec ? 0 : size;
+}
+
+// Loaded snapshot plus journal, as a manager holds them after a full load
+static void loadAll(FileWatch& watch) {
+    CHECK(watch.check() != FileWatch::Change::None);
+    watch.loaded(journalEnd(watch.getFilename()));
+}
+
+static void testAppendsAreReportedAsAppended() {
+    const std::string file = "data/appends.json";
+    writeText(file, "[]");
+    FileWatch watch(file);
+    loadAll(watch);
+    CHECK(watch.check() == FileWatch::Change::None);
+
+    // Enough records that the applied offset lies well past the hashed tail
+    for (int i = 0; i < 200; ++i) {
+        CHECK(JsonJournal::append(file, json{{"id", "R" + std::to_string(i)}, {"padding", std::string(40, 'x')}}));
+    }
+    CHECK(watch.check() == FileWatch::Change::Appended);
+    CHECK(watch.getJournalOffset() == 0);
+    watch.loaded(journalEnd(file));
+    CHECK(watch.check() == FileWatch::Change::None);
+
+    std::uintmax_t applied = journalEnd(file);
+    CHECK(JsonJournal::append(file, json{{"id", "R200"}}));
+    CHECK(watch.check() == FileWatch::Change::Appended);
+    CHECK(watch.getJournalOffset() == applied);
+    watch.loaded(journalEnd(file));
+    CHECK(watch.check() == FileWatch::Change::None);
+}
+
+// The journal rewritten in place (not appended to) with the applied bytes
+// changed just before the offset
+static void testRewrittenJournalTailIsReplaced() {
+    const std::string file = "data/rewritten.json";
+    writeText(file, "[]");
+    CHECK(JsonJournal::append(file, json{{"id", "R1"}}));
+    CHECK(JsonJournal::append(file, json{{"id", "R2"}}));
+    FileWatch watch(file);
+    loadAll(watch);
+
+    std::string journal = JsonJournal::journalPath(file);
+    {
+        std::fstream out(journal, std::ios::in | std::ios::out | std::ios::binary);
+        out.seekp(static_cast<std::streamoff>(journalEnd(file) - 3));
+        out << '9';
+    }
+    std::ofstream(journal, std::ios::binary | std::ios::app) << "{\"id\":\"R3\"}\n";
+    CHECK(watch.check() == FileWatch::Change::Replaced);
+}
+
+// A new journal file (e.g. deleted and rebuilt) is not the one applied
+static void testRecreatedJournalIsReplaced() {
+    const std::string file = "data/recreated.json";
+    writeText(file, "[]");
+    CHECK(JsonJournal::append(file, json{{"id", "R1"}}));
+    FileWatch watch(file);
+    loadAll(watch);
+
+    std::string journal = JsonJournal::journalPath(file);
+    std::string contents = "{\"id\":\"R1\"}\n{\"id\":\"R2\"}\n";
+    writeText(journal + ".new", contents);
+    fs::rename(journal + ".new", journal);
+    CHECK(watch.check() == FileWatch::Change::Replaced);
+}
+
+// A shorter journal is reloaded in full, once: the reload starts from 0
+static void testShrunkJournalIsReloadedOnce() {
+    const std::string file = "data/shrunk.json";
+    writeText(file, "[]");
+    CHECK(JsonJournal::append(file, json{{"id", "R1"}}));
+    CHECK(JsonJournal::append(file, json{{"id", "R2"}}));
+    FileWatch watch(file);
+    loadAll(watch);
+
+    writeText(JsonJournal::journalPath(file), "{\"id\":\"R1\"}\n");
+    CHECK(watch.check() == FileWatch::Change::Replaced);
+    CHECK(watch.getJournalOffset() == 0);
+    watch.loaded(journalEnd(file));
+    CHECK(watch.check() == FileWatch::Change::None);
+}
+
+// A stamp still describes the start of a file that has only grown by
+// journal records since
+static void testStampCoversAppendedJournal() {
+    const std::string file = "data/stamped.json";
+    writeText(file, "[]");
+    CHECK(JsonJournal::append(file, json{{"id", "R1"}}));
+    FileWatch watch(file);
+    loadAll(watch);
+    FileWatch::Stamp stamp;
+    CHECK(watch.getStamp(stamp));
+    CHECK(watch.startsWith(stamp));
+
+    CHECK(JsonJournal::append(file, json{{"id", "R2"}}));
+    CHECK(watch.check() == FileWatch::Change::Appended);
+    watch.loaded(journalEnd(file));
+    FileWatch::Stamp grown;
+    CHECK(watch.getStamp(grown));
+    CHECK(grown != stamp);
+    CHECK(watch.startsWith(stamp));
+    CHECK(!FileWatch(file).startsWith(stamp));
+
+    writeText(JsonJournal::journalPath(file), "{\"id\":\"R10\"}\n{\"id\":\"R2\"}\n");
+    CHECK(watch.check() == FileWatch::Change::Replaced);
+    watch.loaded(journalEnd(file));
+    CHECK(!watch.startsWith(stamp));
+}
+
+static void testRewrittenSnapshotIsReplaced() {
+    const std::string file = "data/snapshot.json";
+    writeText(file, "[]");
+    FileWatch watch(file);
+    loadAll(watch);
+
+    writeText(file, R"([{"id":"R1"}])");
+    CHECK(watch.check() == FileWatch::Change::Replaced);
+    watch.loaded(0);
+    CHECK(watch.check() == FileWatch::Change::None);
+}
+
+int main() {
+    enterScratchDirectory("esports_test_file_watch");
+
+    testAppendsAreReportedAsAppended();
+    testRewrittenJournalTailIsReplaced();
+    testRecreatedJournalIsReplaced();
+    testShrunkJournalIsReloadedOnce();
+    testStampCoversAppendedJournal();
+    testRewrittenSnapshotIsReplaced();
+    return testResult("test_file_watch");
+}
@@ -0,0 +1,90 @@
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <nlohmann/json.hpp>
+#include "TestSupport.hpp"
+#include "helper/AtomicFile.hpp"
+#include "helper/JsonJournal.hpp"
+#include "helper/SnapshotFile.hpp"
+
+using json = nlohmann::json;
+namespace fs = std::filesystem;
+
+static void writeText(const std::string& path, const std::string& text) {
+    std::ofstream(path, std::ios::binary) << text;
+}
+
+static int journalLines(const std::string& filename) {
+    int lines = 0;
+    JsonJournal::forEachLine(filename, [&lines](const std::string&) { lines++; });
+    return lines;
+}
+
+static int snapshotRecords(const std::string& filename) {
+    json data;
+    return SnapshotFile::read(filename, data) ? static_cast<int>(data.size()) : -1;
+}
+
+static void testReplaceSnapshotRetiresJournal() {
+    const std::string file = "data/replace.json";
+    writeText(file, "[]");
+    CHECK(JsonJournal::append(file, json{{"id", "R1"}}));
+    CHECK(JsonJournal::append(file, json{{"id", "R2"}}));
+    CHECK(journalLines(file) == 2);
+
+    CHECK(JsonJournal::replaceSnapshot(file, R"([{"id":"R1"},{"id":"R2"}])"));
+    CHECK(snapshotRecords(file) == 2);
+    CHECK(!fs::exists(JsonJournal::journalPath(file)));
+    CHECK(!fs::exists(JsonJournal::retiredJournalPath(file)));
+    CHECK(!fs::exists(AtomicFile::tempPath(file)));
+    CHECK(JsonJournal::containsId(file, "R2"));
+}
+
+// Crash after the journal was retired but before the snapshot was renamed
+// in: the old snapshot is live, so its journal must come back
+static void testRecoverBeforeSnapshotRename() {
+    const std::string file = "data/crash_before.json";
+    writeText(file, R"([{"id":"R1"}])");
+    writeText(JsonJournal::retiredJournalPath(file), "{\"id\":\"R2\"}\n");
+    writeText(AtomicFile::tempPath(file), R"([{"id":"R1"},{"id":"R2"}])");
+
+    CHECK(journalLines(file) == 1);
+    CHECK(snapshotRecords(file) == 1);
+    CHECK(!fs::exists(JsonJournal::retiredJournalPath(file)));
+    CHECK(!fs::exists(AtomicFile::tempPath(file)));
+}
+
+// Crash after the snapshot was renamed in but before the old journal was
+// deleted: the snapshot already holds it, so it must not be replayed
+static void testRecoverAfterSnapshotRename() {
+    const std::string file = "data/crash_after.json";
+    writeText(file, R"([{"id":"R1"},{"id":"R2"}])");
+    writeText(JsonJournal::retiredJournalPath(file), "{\"id\":\"R2\"}\n");
+
+    json data;
+    CHECK(SnapshotFile::read(file, data));
+    JsonJournal::replay(file, data);
+    CHECK(data.size() == 2);
+    CHECK(!fs::exists(JsonJournal::retiredJournalPath(file)));
+}
+
+static void testCompactionFoldsJournal() {
+    const std::string file = "data/compact.json";
+    writeText(file, "[]");
+    for (int i = 0; i < JsonJournal::COMPACT_MIN_RECORDS; ++i) {
+        CHECK(JsonJournal::append(file, json{{"id", "R" + std::to_string(i)}}));
+    }
+    CHECK(JsonJournal::pendingRecords(file) == 0);
+    CHECK(snapshotRecords(file) == JsonJournal::COMPACT_MIN_RECORDS);
+    CHECK(journalLines(file) == 0);
+    CHECK(!fs::exists(JsonJournal::retiredJournalPath(file)));
+}
+
+int main() {
+    enterScratchDirectory("esports_test_json_journal");
+    testReplaceSnapshotRetiresJournal();
+    testRecoverBeforeSnapshotRename();
+    testRecoverAfterSnapshotRename();
+    testCompactionFoldsJournal();
+    return testResult("test_json_journal");
+}
@@ -0,0 +1,93 @@
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include "TestSupport.hpp"
+#include "structures/DynamicArray.hpp"
+#include "structures/MpmcRingQueue.hpp"
+
+static void testSingleThreadedInterface() {
+    MpmcRingQueue<int> queue(3);
+    CHECK(queue.getCapacity() == 4);
+    CHECK(queue.isEmpty());
+    for (int i = 0; i < 4; ++i) CHECK(queue.tryEnqueue(i));
+    CHECK(queue.isFull());
+    CHECK(!queue.tryEnqueue(99));
+
+    bool threw = false;
+    try {
+        queue.enqueue(99);
+    } catch (const std::overflow_error&) {
+        threw = true;
+    }
+    CHECK(threw);
+
+    CHECK(queue.peek() == 0);
+    CHECK(queue.dequeue() == 0);
+    DynamicArray<int> batch;
+    CHECK(queue.dequeueBatch(batch, 2) == 2);
+    CHECK(batch[0] == 1 && batch[1] == 2);
+    CHECK(queue.size() == 1);
+    queue.clear();
+    CHECK(queue.isEmpty());
+
+    int out = 0;
+    CHECK(!queue.tryDequeue(out));
+}
+
+// Producers push (producer, sequence) pairs through a small ring so it wraps
+// many times; consumers check every value arrives exactly once and that each
+// producer's values arrive in order at any single consumer
+static void testConcurrentProducersAndConsumers(int producers, int consumers) {
+    const int perProducer = 50000;
+    MpmcRingQueue<long long> queue(64);
+    DynamicArray<std::atomic<int>*> seen;
+    for (int i = 0; i < producers * perProducer; ++i) seen.push_back(new std::atomic<int>(0));
+    std::atomic<int> consumed(0);
+    std::atomic<int> orderErrors(0);
+
+    DynamicArray<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.push_back(std::thread([&queue, p, perProducer]() {
+            for (int i = 0; i < perProducer; ++i) {
+                queue.enqueueBlocking(static_cast<long long>(p) * perProducer + i);
+            }
+        }));
+    }
+    for (int c = 0; c < consumers; ++c) {
+        threads.push_back(std::thread([&, producers]() {
+            DynamicArray<long long> last;
+            for (int p = 0; p < producers; ++p) last.push_back(-1);
+            long long value;
+            while (consumed.load() < producers * perProducer) {
+                if (!queue.tryDequeue(value)) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                int producer = static_cast<int>(value / perProducer);
+                if (value <= last[producer]) orderErrors++;
+                last[producer] = value;
+                seen[static_cast<int>(value)]->fetch_add(1);
+                consumed++;
+            }
+        }));
+    }
+    for (std::thread& thread : threads) thread.join();
+
+    int wrong = 0;
+    for (std::atomic<int>* count : seen) {
+        if (count->load() != 1) wrong++;
+        delete count;
+    }
+    CHECK(wrong == 0);
+    CHECK(orderErrors.load() == 0);
+    CHECK(consumed.load() == producers * perProducer);
+    CHECK(queue.isEmpty());
+}
+
+int main() {
+    testSingleThreadedInterface();
+    testConcurrentProducersAndConsumers(1, 1);
+    testConcurrentProducersAndConsumers(4, 1);
+    testConcurrentProducersAndConsumers(4, 4);
+    return testResult("test_mpmc_ring_queue");
+}
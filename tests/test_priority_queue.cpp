@@ -0,0 +1,74 @@
+#include <string>
+#include "TestSupport.hpp"
+#include "dto/Player.hpp"
+#include "structures/PriorityQueue.hpp"
+
+using CheckInQueue = PriorityQueue<Player, PlayerIdKey>;
+
+static Player player(const std::string& id) {
+    Player p;
+    p.id = id;
+    p.name = "Name " + id;
+    return p;
+}
+
+// Larger priority values dequeue first; equal values in arrival order
+static void testDequeueOrderIsPriorityThenArrival() {
+    CheckInQueue queue;
+    queue.enqueue(player("P1"), 1);
+    queue.enqueue(player("P2"), 3);
+    queue.enqueue(player("P3"), 1);
+    queue.enqueue(player("P4"), 2);
+    CHECK(queue.dequeue().id == "P2");
+    CHECK(queue.dequeue().id == "P4");
+    CHECK(queue.dequeue().id == "P1");
+    CHECK(queue.dequeue().id == "P3");
+    CHECK(queue.isEmpty());
+}
+
+static void testKeyedUpdateAndErase() {
+    CheckInQueue queue;
+    for (int i = 0; i < 20; ++i) {
+        queue.enqueue(player("P" + std::to_string(i)), 3);
+    }
+    CHECK(queue.contains("P7"));
+    CHECK(queue.getPriority("P7") == 3);
+
+    // Raising P19 sifts it to the root, so the slot find() pointed at now
+    // holds another player; callers must not keep the pointer across it
+    const Player* before = queue.find("P19");
+    CHECK(before && before->name == "Name P19");
+    CHECK(queue.updatePriority("P19", 10));
+    CHECK(before->name != "Name P19");
+    CHECK(queue.find("P19")->name == "Name P19");
+    CHECK(queue.peek().id == "P19");
+
+    CHECK(queue.erase("P19"));
+    CHECK(!queue.contains("P19"));
+    CHECK(!queue.erase("P19"));
+    CHECK(!queue.updatePriority("missing", 1));
+    CHECK(queue.getSize() == 19);
+
+    // Every remaining key still resolves to its own entry
+    for (int i = 0; i < 19; ++i) {
+        std::string id = "P" + std::to_string(i);
+        const Player* found = queue.find(id);
+        CHECK(found && found->id == id);
+    }
+}
+
+static void testEnqueueExistingKeyUpdatesInPlace() {
+    CheckInQueue queue;
+    queue.enqueue(player("P1"), 1);
+    queue.enqueue(player("P2"), 2);
+    queue.enqueue(player("P1"), 3);
+    CHECK(queue.getSize() == 2);
+    CHECK(queue.peek().id == "P1");
+}
+
+int main() {
+    testDequeueOrderIsPriorityThenArrival();
+    testKeyedUpdateAndErase();
+    testEnqueueExistingKeyUpdatesInPlace();
+    return testResult("test_priority_queue");
+}
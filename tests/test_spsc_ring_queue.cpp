@@ -0,0 +1,91 @@
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include "TestSupport.hpp"
+#include "structures/DynamicArray.hpp"
+#include "structures/SpscRingQueue.hpp"
+
+static void testSingleThreadedInterface() {
+    SpscRingQueue<int> queue(3);
+    CHECK(queue.getCapacity() == 4);
+    CHECK(queue.isEmpty());
+    for (int i = 0; i < 4; ++i) CHECK(queue.tryEnqueue(i));
+    CHECK(queue.isFull());
+    CHECK(!queue.tryEnqueue(99));
+
+    bool threw = false;
+    try {
+        queue.enqueue(99);
+    } catch (const std::overflow_error&) {
+        threw = true;
+    }
+    CHECK(threw);
+
+    CHECK(queue.peek() == 0);
+    CHECK(queue.dequeue() == 0);
+    DynamicArray<int> batch;
+    CHECK(queue.dequeueBatch(batch, 2) == 2);
+    CHECK(batch[0] == 1 && batch[1] == 2);
+    CHECK(queue.size() == 1);
+    queue.clear();
+    CHECK(queue.isEmpty());
+
+    int out = 0;
+    CHECK(!queue.tryDequeue(out));
+    threw = false;
+    try {
+        queue.dequeue();
+    } catch (const std::underflow_error&) {
+        threw = true;
+    }
+    CHECK(threw);
+}
+
+// Strings are moved in and out of raw slots; wrapping must neither leak nor
+// double-destroy them
+static void testNonTrivialItemsWrap() {
+    SpscRingQueue<std::string> queue(4);
+    for (int round = 0; round < 10; ++round) {
+        for (int i = 0; i < 3; ++i) queue.enqueueBlocking(std::string(40, static_cast<char>('a' + i)));
+        CHECK(queue.dequeue() == std::string(40, 'a'));
+        DynamicArray<std::string> batch;
+        CHECK(queue.dequeueBatch(batch) == 2);
+        CHECK(batch[1] == std::string(40, 'c'));
+    }
+    queue.enqueue("left behind");  // Destroyed with the queue
+}
+
+// One producer pushes an increasing sequence through a small ring so it
+// wraps many times; the consumer must see every value once, in order
+static void testProducerAndConsumer() {
+    const int count = 200000;
+    SpscRingQueue<int> queue(64);
+    std::thread producer([&queue]() {
+        for (int i = 0; i < count; ++i) queue.enqueueBlocking(i);
+    });
+
+    int expected = 0;
+    int outOfOrder = 0;
+    DynamicArray<int> batch;
+    while (expected < count) {
+        batch.clear();
+        if (queue.dequeueBatch(batch, 16) == 0) {
+            std::this_thread::yield();
+            continue;
+        }
+        for (int value : batch) {
+            if (value != expected) outOfOrder++;
+            expected++;
+        }
+    }
+    producer.join();
+    CHECK(outOfOrder == 0);
+    CHECK(queue.isEmpty());
+}
+
+int main() {
+    testSingleThreadedInterface();
+    testNonTrivialItemsWrap();
+    testProducerAndConsumer();
+    return testResult("test_spsc_ring_queue");
+}
@@ -0,0 +1,209 @@
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include "TestSupport.hpp"
+#include "dto/Match.hpp"
+#include "dto/Player.hpp"
+#include "dto/Result.hpp"
+#include "functions/GameResultLogger.hpp"
+#include "helper/DtoCodec.hpp"
+#include "helper/GroupCommit.hpp"
+#include "helper/JsonJournal.hpp"
+#include "helper/JsonWriter.hpp"
+#include "helper/ResultEvents.hpp"
+#include "helper/WriteBehindCache.hpp"
+#include "structures/DynamicArray.hpp"
+
+// GameResultLogger restores statistics from data/stats_checkpoint.json only
+// while the results, matches and players it covers are unchanged
+
+static const int PLAYERS = 8;
+static const int RESULTS = 1500;
+
+static DynamicArray<Player> players;
+static DynamicArray<Match> matches;
+static DynamicArray<Result> results;
+
+static void writeFile(const std::string& filename, const std::string& bytes) {
+    std::ofstream(filename, std::ios::binary) << bytes;
+}
+
+static void writeData() {
+    writeFile("data/players.json", DtoCodec::encodeArray(players, StorageFormat::Json));
+    writeFile("data/matches.json", DtoCodec::encodeArray(matches, StorageFormat::Json));
+    writeFile("data/results.json", DtoCodec::encodeArray(results, StorageFormat::Json));
+}
+
+static void generateData() {
+    for (int i = 0; i < PLAYERS; ++i) {
+        players.emplace_back("P" + std::to_string(i), "Name" + std::to_string(i), 20, Gender::Male,
+                             "p@example.com", "0100000000", 0, false, false, false, "2025-01-01");
+    }
+    for (int i = 0; i < RESULTS; ++i) {
+        std::string p1 = "P" + std::to_string(i % PLAYERS);
+        std::string p2 = "P" + std::to_string((i + 3) % PLAYERS);
+        matches.emplace_back("M" + std::to_string(i), "T1", TournamentStage::Qualifiers, "2025-01-02", "10:00", p1, p2);
+        results.emplace_back("R" + std::to_string(i), "M" + std::to_string(i),
+                             static_cast<Champion>(i % 12), static_cast<Champion>((i + 1) % 12), i % 3 ? p1 : p2);
+    }
+    writeData();
+}
+
+// Wins of playerId, counted straight from the generated data
+static int expectedWins(const std::string& playerId) {
+    int wins = 0;
+    for (const Result& result : results) {
+        if (result.winnerId == playerId) wins++;
+    }
+    return wins;
+}
+
+// "Wins: N" from the logger's player report
+static int reportedWins(const GameResultLogger& logger, const std::string& playerId) {
+    std::ostringstream captured;
+    std::streambuf* original = std::cout.rdbuf(captured.rdbuf());
+    logger.displayPlayerPerformance(playerId);
+    std::cout.rdbuf(original);
+
+    std::string text = captured.str();
+    std::size_t at = text.find("\nWins: ");
+    return at == std::string::npos ? -1 : std::stoi(text.substr(at + 7));
+}
+
+// The logger's matchup table for a champion, as printed
+static std::string championReport(const GameResultLogger& logger, const std::string& champion) {
+    std::ostringstream captured;
+    std::streambuf* original = std::cout.rdbuf(captured.rdbuf());
+    logger.displayChampionStatistics(champion);
+    std::cout.rdbuf(original);
+    return captured.str();
+}
+
+// Whether construction restored the checkpoint; drains the operation history
+static bool restoredFromCheckpoint(GameResultLogger& logger) {
+    bool restored = false;
+    std::string operation;
+    while ((operation = logger.getLastOperation()) != "No operations recorded") {
+        if (operation.rfind("Statistics restored from checkpoint", 0) == 0) restored = true;
+    }
+    return restored;
+}
+
+// Statistics restored from a checkpoint and extended agree with a recount
+static void checkAgainstRecount(GameResultLogger& logger) {
+    int wins[PLAYERS];
+    for (int i = 0; i < PLAYERS; ++i) {
+        wins[i] = reportedWins(logger, "P" + std::to_string(i));
+    }
+    std::string akali = championReport(logger, "Akali");
+    std::string garen = championReport(logger, "Garen");
+    logger.calculatePlayerStatistics();
+    for (int i = 0; i < PLAYERS; ++i) {
+        CHECK(reportedWins(logger, "P" + std::to_string(i)) == wins[i]);
+    }
+    CHECK(championReport(logger, "Akali") == akali);
+    CHECK(championReport(logger, "Garen") == garen);
+}
+
+// Construct a logger over the current files, check its counts, and leave
+// an up-to-date checkpoint behind
+static bool loadAndCheck() {
+    bool restored;
+    {
+        GameResultLogger logger;
+        for (int i = 0; i < PLAYERS; ++i) {
+            std::string id = "P" + std::to_string(i);
+            CHECK(reportedWins(logger, id) == expectedWins(id));
+        }
+        restored = restoredFromCheckpoint(logger);
+    }
+    CHECK(WriteBehindCache::instance().flush());
+    return restored;
+}
+
+// Results saved while the logger runs are counted as they are published,
+// without a file check that would commit each append on its own
+static void testPublishedResultsShareCommits() {
+    GroupCommit& commit = GroupCommit::instance();
+    std::chrono::milliseconds window = commit.getWindow();
+    commit.setWindow(std::chrono::milliseconds(10000));
+    {
+        GameResultLogger logger;
+        int winsBefore[PLAYERS];
+        for (int i = 0; i < PLAYERS; ++i) {
+            winsBefore[i] = reportedWins(logger, "P" + std::to_string(i));
+        }
+
+        long long commits = commit.getCommitCount();
+        int added[PLAYERS] = {};
+        for (int i = 0; i < 200; ++i) {
+            const Match& match = matches[i];
+            Result result("R" + std::to_string(RESULTS + i), match.id, Champion::NoChampion,
+                          Champion::NoChampion, match.player1);
+            CHECK(JsonWriter::appendResult(result));
+            ResultEvents::publish("data/results.json", result);
+            added[std::stoi(match.player1.substr(1))]++;
+        }
+        CHECK(commit.getCommitCount() == commits);
+        for (int i = 0; i < PLAYERS; ++i) {
+            CHECK(reportedWins(logger, "P" + std::to_string(i)) == winsBefore[i] + added[i]);
+        }
+    }
+    commit.setWindow(window);
+    CHECK(WriteBehindCache::instance().flush());
+}
+
+int main() {
+    enterScratchDirectory("esports_test_stats_checkpoint");
+    generateData();
+
+    CHECK(!loadAndCheck());
+    CHECK(loadAndCheck());
+
+    // A different winner in the middle: same ids, count and unmatched count
+    Result& edited = results[RESULTS / 2];
+    edited.winnerId = edited.winnerId == matches[RESULTS / 2].player1 ? matches[RESULTS / 2].player2
+                                                                      : matches[RESULTS / 2].player1;
+    writeData();
+    CHECK(!loadAndCheck());
+    CHECK(loadAndCheck());
+
+    // A match handed to another player; every result still finds its match
+    Match& moved = matches[RESULTS / 3];
+    std::string previous = moved.player1;
+    moved.player1 = "P" + std::to_string((RESULTS / 3 + 5) % PLAYERS);
+    Result& movedResult = results[RESULTS / 3];
+    if (movedResult.winnerId == previous) movedResult.winnerId = moved.player1;
+    writeFile("data/matches.json", DtoCodec::encodeArray(matches, StorageFormat::Json));
+    writeFile("data/results.json", DtoCodec::encodeArray(results, StorageFormat::Json));
+    CHECK(!loadAndCheck());
+
+    // Only matches.json edited: the winner stays, so the match's players change
+    matches[RESULTS / 4].player2 = "P" + std::to_string((RESULTS / 4 + 5) % PLAYERS);
+    writeFile("data/matches.json", DtoCodec::encodeArray(matches, StorageFormat::Json));
+    {
+        GameResultLogger logger;
+        CHECK(!restoredFromCheckpoint(logger));
+    }
+    CHECK(WriteBehindCache::instance().flush());
+
+    testPublishedResultsShareCommits();
+
+    // Results appended to the journal since the checkpoint: it still applies,
+    // and only the appended results are counted on top of it
+    for (int i = 0; i < 50; ++i) {
+        const Match& match = matches[RESULTS - 1 - i];
+        CHECK(JsonJournal::append("data/results.json",
+                                  DtoCodec::toJson(Result("R" + std::to_string(RESULTS + 200 + i), match.id,
+                                                          Champion::Akali, Champion::Garen, match.player2))));
+    }
+    {
+        GameResultLogger logger;
+        CHECK(restoredFromCheckpoint(logger));
+        checkAgainstRecount(logger);
+    }
+    CHECK(WriteBehindCache::instance().flush());
+    return testResult("test_stats_checkpoint");
+}
@@ -0,0 +1,173 @@
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <nlohmann/json.hpp>
+#include "TestSupport.hpp"
+#include "helper/GroupCommit.hpp"
+#include "helper/JsonJournal.hpp"
+#include "helper/JsonLoader.hpp"
+#include "helper/JsonWriter.hpp"
+#include "helper/WriteBehindCache.hpp"
+
+using json = nlohmann::json;
+namespace fs = std::filesystem;
+
+static std::string readText(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    std::ostringstream text;
+    text << in.rdbuf();
+    return text.str();
+}
+
+static void save(const std::string& filename, const std::string& bytes) {
+    WriteBehindCache::instance().markDirty(filename, [bytes]() { return bytes; });
+}
+
+static void testUnchangedSnapshotIsSkipped() {
+    WriteBehindCache& cache = WriteBehindCache::instance();
+    const std::string file = "data/unchanged.json";
+    WriteBehindCache::Counters before = cache.getCounters();
+
+    save(file, "[1]");
+    CHECK(JsonWriter::flush(file));
+    save(file, "[1]");
+    CHECK(JsonWriter::flush(file));
+
+    WriteBehindCache::Counters after = cache.getCounters();
+    CHECK(readText(file) == "[1]");
+    CHECK(after.written - before.written == 1);
+    CHECK(after.unchanged - before.unchanged == 1);
+}
+
+// A failed commit must reach the caller, and must not make the next save
+// of the same content look unchanged
+static void testFailedCommitIsReportedAndRetried() {
+    WriteBehindCache& cache = WriteBehindCache::instance();
+    const std::string file = "missing/retry.json";
+    WriteBehindCache::Counters before = cache.getCounters();
+
+    save(file, "[2]");
+    CHECK(!JsonWriter::flush(file));
+    CHECK(cache.getCounters().failed - before.failed == 1);
+
+    fs::create_directories("missing");
+    save(file, "[2]");
+    CHECK(JsonWriter::flush(file));
+    CHECK(readText(file) == "[2]");
+    CHECK(cache.getCounters().unchanged == before.unchanged);
+}
+
+// A commit done by the background threads fails before anyone waits; the
+// next flush of the file still reports it, and the snapshot is kept until
+// it can be written
+static void testBackgroundFailureIsReportedOnFlush() {
+    const std::string file = "absent/background.json";
+    long long failuresBefore = GroupCommit::instance().getFailureCount();
+
+    save(file, "[3]");
+    for (int i = 0; i < 200 && GroupCommit::instance().getFailureCount() == failuresBefore; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    CHECK(GroupCommit::instance().getFailureCount() > failuresBefore);
+    CHECK(!JsonWriter::flush(file));
+
+    fs::create_directories("absent");
+    CHECK(JsonWriter::flush(file));
+    CHECK(readText(file) == "[3]");
+}
+
+// Journal appends that fail are queued again, in order, ahead of later
+// ones, and land once the file can be written
+static void testFailedAppendLandsLater() {
+    GroupCommit& commit = GroupCommit::instance();
+    const std::string file = "unwritable/appends.json";
+
+    commit.submitAppend(file, json{{"id", "A1"}});
+    CHECK(!commit.flush(file));
+    commit.submitAppend(file, json{{"id", "A2"}});
+    CHECK(!commit.flush(file));
+
+    fs::create_directories("unwritable");
+    commit.submitAppend(file, json{{"id", "A3"}});
+    CHECK(commit.flush(file));
+    CHECK(readText(JsonJournal::journalPath(file)) == "{\"id\":\"A1\"}\n{\"id\":\"A2\"}\n{\"id\":\"A3\"}\n");
+}
+
+// submit() hands the snapshot over unbuilt: the append after it is ordered
+// behind it inside GroupCommit, and the build waits for the commit
+static void testSubmitDoesNotBuildOnCaller() {
+    GroupCommit& commit = GroupCommit::instance();
+    const std::string file = "data/deferred.json";
+    std::chrono::milliseconds window = commit.getWindow();
+    commit.setWindow(std::chrono::milliseconds(10000));
+
+    std::atomic<bool> built(false);
+    WriteBehindCache::instance().markDirty(file, [&built]() {
+        built = true;
+        return std::string("[]");
+    });
+    WriteBehindCache::instance().submit(file);
+    commit.submitAppend(file, json{{"id", "A1"}});
+    CHECK(!built);
+
+    CHECK(JsonWriter::flush(file));
+    CHECK(built);
+    CHECK(readText(file) == "[]");
+    CHECK(JsonJournal::pendingRecords(file) == 1);
+    commit.setWindow(window);
+}
+
+// Duplicates are found among players still queued, without a flush
+static void testAppendPlayerRejectsQueuedDuplicate() {
+    const std::string file = "data/players_index.json";
+    Player first("P1", "Name", 20, Gender::Male, "p@example.com", "0100000000", 0, false, false, false, "2025-01-01");
+    Player second("P2", "Name", 20, Gender::Male, "p@example.com", "0100000000", 0, false, false, false, "2025-01-01");
+
+    DoublyLinkedList<Player> players;
+    players.append(first);
+    CHECK(JsonWriter::writeAllPlayers(players, file));
+    CHECK(!JsonWriter::appendPlayer(first, file));
+    CHECK(JsonWriter::appendPlayer(second, file));
+    CHECK(!JsonWriter::appendPlayer(second, file));
+
+    CHECK(JsonWriter::flush(file));
+    CHECK(JsonLoader::readPlayers(file).getSize() == 2);
+}
+
+// An append after a snapshot makes the file differ from it, so saving the
+// same snapshot again must rewrite the file
+static void testAppendInvalidatesUnchangedCheck() {
+    WriteBehindCache& cache = WriteBehindCache::instance();
+    const std::string file = "data/appended.json";
+
+    save(file, "[]");
+    CHECK(JsonWriter::flush(file));
+    cache.submit(file);
+    GroupCommit::instance().submitAppend(file, json{{"id", "A1"}});
+    CHECK(JsonWriter::flush(file));
+    CHECK(JsonJournal::pendingRecords(file) == 1);
+
+    WriteBehindCache::Counters before = cache.getCounters();
+    save(file, "[]");
+    CHECK(JsonWriter::flush(file));
+    CHECK(cache.getCounters().written - before.written == 1);
+    CHECK(!fs::exists(JsonJournal::journalPath(file)));
+}
+
+int main() {
+    enterScratchDirectory("esports_test_write_behind_cache");
+    WriteBehindCache::instance().setMaxStaleness(std::chrono::milliseconds(1));
+
+    testUnchangedSnapshotIsSkipped();
+    testFailedCommitIsReportedAndRetried();
+    testBackgroundFailureIsReportedOnFlush();
+    testFailedAppendLandsLater();
+    testAppendInvalidatesUnchangedCheck();
+    testSubmitDoesNotBuildOnCaller();
+    testAppendPlayerRejectsQueuedDuplicate();
+    return testResult("test_write_behind_cache");
+}